@@ -15,6 +15,7 @@
 #define OR_TOOLS_SAT_2D_DISTANCES_PROPAGATOR_H_
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,7 @@ class Precedences2DPropagator : public PropagatorInterface {
 
   ~Precedences2DPropagator() override;
 
+  std::string Name() const final { return "Precedences2DPropagator"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -15,6 +15,7 @@
 #define OR_TOOLS_SAT_2D_MANDATORY_OVERLAP_PROPAGATOR_H_
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "ortools/sat/diffn_util.h"
@@ -41,6 +42,7 @@ class MandatoryOverlapPropagator : public PropagatorInterface {
 
   ~MandatoryOverlapPropagator() override;
 
+  std::string Name() const final { return "MandatoryOverlapPropagator"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
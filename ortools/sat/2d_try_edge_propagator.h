@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -54,6 +55,7 @@ class TryEdgeRectanglePropagator : public PropagatorInterface {
 
   ~TryEdgeRectanglePropagator() override;
 
+  std::string Name() const final { return "TryEdgeRectanglePropagator"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
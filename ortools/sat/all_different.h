@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -161,6 +162,7 @@ class AllDifferentBoundsPropagator : public PropagatorInterface {
   AllDifferentBoundsPropagator& operator=(const AllDifferentBoundsPropagator&) =
       delete;
 
+  std::string Name() const final { return "AllDifferentBoundsPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <deque>
+#include <memory>
 #include <new>
 #include <queue>
 #include <string>
@@ -84,7 +85,6 @@ ClauseManager::ClauseManager(Model* model)
 }
 
 ClauseManager::~ClauseManager() {
-  gtl::STLDeleteElements(&clauses_);
   IF_STATS_ENABLED(LOG(INFO) << stats_.StatString());
 }
 
@@ -102,6 +102,16 @@ void ClauseManager::AttachOnFalse(Literal literal, Literal blocking_literal,
   SCOPED_TIME_STAT(&stats_);
   DCHECK(is_clean_);
   DCHECK(!WatcherListContains(watchers_on_false_[literal], *clause));
+  if (clause->size() == 3) {
+    const Literal* literals = clause->begin();
+    const Literal other(LiteralIndex(
+        literals[0].Index().value() ^ literals[1].Index().value() ^
+        literals[2].Index().value() ^ literal.Index().value() ^
+        blocking_literal.Index().value()));
+    watchers_on_false_[literal].push_back(
+        Watcher::ForTernaryClause(clause, blocking_literal, other));
+    return;
+  }
   watchers_on_false_[literal].push_back(Watcher(clause, blocking_literal));
 }
 
@@ -125,6 +135,18 @@ bool ClauseManager::PropagateOnFalse(Literal false_literal, Trail* trail) {
       *new_it++ = *it;
       continue;
     }
+
+    // For a ternary clause, we can also check the last literal without looking
+    // at the clause. If it is true, we make it the blocking literal.
+    if (it->IsTernary()) {
+      const Literal other = it->OtherLiteral();
+      if (assignment.LiteralIsTrue(other)) {
+        *new_it++ =
+            Watcher::ForTernaryClause(it->clause, other, it->blocking_literal);
+        ++num_ternary_inline_skips_;
+        continue;
+      }
+    }
     ++num_inspected_clauses_;
 
     // If the other watched literal is true, just change the blocking literal.
@@ -135,6 +157,9 @@ bool ClauseManager::PropagateOnFalse(Literal false_literal, Trail* trail) {
         LiteralIndex(literals[0].Index().value() ^ literals[1].Index().value() ^
                      false_literal.Index().value()));
     if (assignment.LiteralIsTrue(other_watched_literal)) {
+      // This cannot happen for a ternary clause since we checked both of the
+      // other literals above.
+      DCHECK(!it->IsTernary());
       *new_it = *it;
       new_it->blocking_literal = other_watched_literal;
       ++new_it;
@@ -146,7 +171,7 @@ bool ClauseManager::PropagateOnFalse(Literal false_literal, Trail* trail) {
     // fashion from start. The first two literals can be ignored as they are the
     // watched ones.
     {
-      const int start = it->start_index;
+      const int start = it->IsTernary() ? 2 : it->start_index;
       const int size = it->clause->size();
       DCHECK_GE(start, 2);
 
@@ -166,8 +191,13 @@ bool ClauseManager::PropagateOnFalse(Literal false_literal, Trail* trail) {
         literals[0] = other_watched_literal;
         literals[1] = literals[i];
         literals[i] = false_literal;
-        watchers_on_false_[literals[1]].emplace_back(
-            it->clause, other_watched_literal, i + 1);
+        if (it->IsTernary()) {
+          watchers_on_false_[literals[1]].push_back(Watcher::ForTernaryClause(
+              it->clause, other_watched_literal, false_literal));
+        } else {
+          watchers_on_false_[literals[1]].emplace_back(
+              it->clause, other_watched_literal, i + 1);
+        }
         continue;
       }
     }
@@ -226,7 +256,7 @@ bool ClauseManager::AddClause(absl::Span<const Literal> literals) {
 
 bool ClauseManager::AddClause(absl::Span<const Literal> literals, Trail* trail,
                               int lbd) {
-  SatClause* clause = SatClause::Create(literals);
+  SatClause* clause = arena_.Create(literals);
   clauses_.push_back(clause);
   if (add_clause_callback_ != nullptr) add_clause_callback_(lbd, literals);
   return AttachAndPropagate(clause, trail);
@@ -234,7 +264,7 @@ bool ClauseManager::AddClause(absl::Span<const Literal> literals, Trail* trail,
 
 SatClause* ClauseManager::AddRemovableClause(absl::Span<const Literal> literals,
                                              Trail* trail, int lbd) {
-  SatClause* clause = SatClause::Create(literals);
+  SatClause* clause = arena_.Create(literals);
   clauses_.push_back(clause);
   if (add_clause_callback_ != nullptr) add_clause_callback_(lbd, literals);
   CHECK(AttachAndPropagate(clause, trail));
@@ -311,6 +341,9 @@ void ClauseManager::InternalDetach(SatClause* clause) {
   if (drat_proof_handler_ != nullptr && size > 2) {
     drat_proof_handler_->DeleteClause({clause->begin(), size});
   }
+  if (lrat_proof_handler_ != nullptr && size > 2) {
+    lrat_proof_handler_->DeleteClause({clause->begin(), size});
+  }
   clauses_info_.erase(clause);
   clause->Clear();
 }
@@ -351,6 +384,7 @@ void ClauseManager::AttachAllClauses() {
   watchers_on_false_.resize(needs_cleaning_.size().value());
 
   DeleteRemovedClauses();
+  MaybeCompactClauseArena();
   for (SatClause* clause : clauses_) {
     ++num_watched_clauses_;
     DCHECK_GE(clause->size(), 2);
@@ -457,7 +491,7 @@ SatClause* ClauseManager::InprocessingAddClause(
     return nullptr;
   }
 
-  SatClause* clause = SatClause::Create(new_clause);
+  SatClause* clause = arena_.Create(new_clause);
   clauses_.push_back(clause);
   return clause;
 }
@@ -489,7 +523,7 @@ void ClauseManager::DeleteRemovedClauses() {
     if (i == to_first_minimize_index_) to_first_minimize_index_ = new_size;
     if (i == to_probe_index_) to_probe_index_ = new_size;
     if (clauses_[i]->IsRemoved()) {
-      delete clauses_[i];
+      arena_.Free(clauses_[i]);
     } else {
       clauses_[new_size++] = clauses_[i];
     }
@@ -501,6 +535,50 @@ void ClauseManager::DeleteRemovedClauses() {
   if (to_probe_index_ > new_size) to_probe_index_ = new_size;
 }
 
+void ClauseManager::MaybeCompactClauseArena() {
+  DCHECK(is_clean_);
+  DCHECK_EQ(num_watched_clauses_, 0);
+  DCHECK_EQ(trail_->CurrentDecisionLevel(), 0);
+
+  // We only compact if at least half the arena is wasted, so that the
+  // compaction cost is amortized by the allocations that made it necessary.
+  // The wasted memory is in the free lists, at the end of the shrunk clauses
+  // and at the end of the blocks.
+  int64_t num_live_words = 0;
+  for (const SatClause* clause : clauses_) {
+    num_live_words += ClauseArena::NumWords(clause->size());
+  }
+  const int64_t num_wasted_words =
+      arena_.num_reserved_words() - num_live_words;
+  if (num_wasted_words < std::max<int64_t>(num_live_words, 1 << 16)) return;
+
+  // The clauses are copied in creation order, which keeps the iteration over
+  // AllClausesInCreationOrder() and our round-robin indices unchanged.
+  ClauseArena new_arena;
+  absl::flat_hash_map<SatClause*, SatClause*> old_to_new;
+  old_to_new.reserve(clauses_.size());
+  absl::flat_hash_map<SatClause*, ClauseInfo> new_clauses_info;
+  new_clauses_info.reserve(clauses_info_.size());
+  for (SatClause*& clause : clauses_) {
+    SatClause* new_clause = new_arena.Create(clause->AsSpan());
+    old_to_new[clause] = new_clause;
+    const auto it = clauses_info_.find(clause);
+    if (it != clauses_info_.end()) new_clauses_info[new_clause] = it->second;
+    clause = new_clause;
+  }
+  clauses_info_ = std::move(new_clauses_info);
+
+  // Some of the level zero propagation might still refer to these clauses.
+  for (int i = 0; i < trail_->Index(); ++i) {
+    const auto it = old_to_new.find(reasons_[i]);
+    if (it != old_to_new.end()) reasons_[i] = it->second;
+  }
+  trail_->SetFailingSatClause(nullptr);
+
+  arena_ = std::move(new_arena);
+  ++num_arena_compactions_;
+}
+
 SatClause* ClauseManager::NextNewClauseToMinimize() {
   for (; to_first_minimize_index_ < clauses_.size();
        ++to_first_minimize_index_) {
@@ -2817,6 +2895,56 @@ SatClause* SatClause::Create(absl::Span<const Literal> literals) {
   return clause;
 }
 
+// ----- ClauseArena -----
+
+SatClause* ClauseArena::Create(absl::Span<const Literal> literals) {
+  DCHECK_GE(literals.size(), 2);
+  const int64_t num_words = NumWords(literals.size());
+  uint32_t* memory;
+  if (num_words < static_cast<int64_t>(free_lists_.size()) &&
+      !free_lists_[num_words].empty()) {
+    memory = free_lists_[num_words].back();
+    free_lists_[num_words].pop_back();
+  } else if (num_words > kBlockSize) {
+    // Huge clauses get their own block. We insert it before the last block so
+    // that we can continue to use the free space there.
+    auto block = std::unique_ptr<uint32_t[]>(new uint32_t[num_words]);
+    memory = block.get();
+    blocks_.insert(blocks_.empty() ? blocks_.end() : blocks_.end() - 1,
+                   std::move(block));
+    num_reserved_words_ += num_words;
+  } else {
+    if (num_words > num_free_words_in_last_block_) {
+      blocks_.push_back(std::unique_ptr<uint32_t[]>(new uint32_t[kBlockSize]));
+      num_free_words_in_last_block_ = kBlockSize;
+      num_reserved_words_ += kBlockSize;
+    }
+    memory =
+        blocks_.back().get() + (kBlockSize - num_free_words_in_last_block_);
+    num_free_words_in_last_block_ -= num_words;
+  }
+  num_used_words_ += num_words;
+
+  memory[0] = num_words;
+  SatClause* clause = reinterpret_cast<SatClause*>(memory + 1);
+  clause->size_ = literals.size();
+  for (int i = 0; i < literals.size(); ++i) {
+    clause->literals_[i] = literals[i];
+  }
+  return clause;
+}
+
+void ClauseArena::Free(SatClause* clause) {
+  uint32_t* memory = reinterpret_cast<uint32_t*>(clause) - 1;
+  const int64_t num_words = memory[0];
+  num_used_words_ -= num_words;
+  if (num_words > kBlockSize) return;
+  if (num_words >= static_cast<int64_t>(free_lists_.size())) {
+    free_lists_.resize(num_words + 1);
+  }
+  free_lists_[num_words].push_back(memory);
+}
+
 // Note that for an attached clause, removing fixed literal is okay because if
 // any of the watched literal is assigned, then the clause is necessarily true.
 bool SatClause::RemoveFixedLiteralsAndTestIfTrue(
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <new>
 #include <string>
 #include <utility>
@@ -36,6 +37,7 @@
 #include "ortools/base/strong_vector.h"
 #include "ortools/graph/cliques.h"
 #include "ortools/sat/drat_proof_handler.h"
+#include "ortools/sat/lrat_proof_handler.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
 #include "ortools/sat/sat_parameters.pb.h"
@@ -48,6 +50,8 @@
 namespace operations_research {
 namespace sat {
 
+class ClauseArena;
+
 // This is how the SatSolver stores a clause. A clause is just a disjunction of
 // literals. In many places, we just use vector<literal> to encode one. But in
 // the critical propagation code, we use this class to remove one memory
@@ -120,6 +124,9 @@ class SatClause {
   // call Clear()/Rewrite.
   friend class ClauseManager;
 
+  // The arena constructs clauses directly in its own memory.
+  friend class ClauseArena;
+
   Literal* literals() { return &(literals_[0]); }
 
   // Marks the clause so that the next call to CleanUpWatchers() can identify it
@@ -141,6 +148,64 @@ class SatClause {
   Literal literals_[0];
 };
 
+// Owns the memory of the clauses of a ClauseManager. Instead of one heap
+// allocation per clause, clauses are carved out of large blocks in creation
+// order. Clauses created together are thus contiguous in memory, which is a lot
+// more cache friendly during propagation. The memory of a deleted clause is
+// kept in a free list per size and reused by the next clause with the same
+// size. The ClauseManager also periodically moves the surviving clauses to a
+// fresh arena to get back the memory of the free lists and of the clauses that
+// were shrunk.
+class ClauseArena {
+ public:
+  ClauseArena() = default;
+  ClauseArena(ClauseArena&&) = default;
+  ClauseArena& operator=(ClauseArena&&) = default;
+
+  // This type is not copyable.
+  ClauseArena(const ClauseArena&) = delete;
+  ClauseArena& operator=(const ClauseArena&) = delete;
+
+  // Same as SatClause::Create() but the memory is owned by the arena, so the
+  // returned clause must never be deleted. It stays valid until it is given
+  // back with Free() or the arena is destroyed.
+  SatClause* Create(absl::Span<const Literal> literals);
+
+  // Gives back the memory of a clause created by this arena. The clause might
+  // have been shrunk or cleared since, but nothing must refer to it anymore.
+  void Free(SatClause* clause);
+
+  // Number of 32-bit words needed to store a clause of the given size. We store
+  // the number of allocated words before each clause, since its size can
+  // decrease afterwards.
+  static int64_t NumWords(int clause_size) {
+    static_assert(sizeof(SatClause) == sizeof(uint32_t));
+    static_assert(sizeof(Literal) == sizeof(uint32_t));
+    return 2 + clause_size;
+  }
+
+  // Number of words of the clauses that were not freed, including the unused
+  // tail of the clauses that were shrunk.
+  int64_t num_used_words() const { return num_used_words_; }
+
+  // Number of words allocated by the arena. This is num_used_words() plus the
+  // words in the free lists and at the end of the blocks.
+  int64_t num_reserved_words() const { return num_reserved_words_; }
+
+ private:
+  // Size of a block in number of 32-bit words. Clauses larger than this get
+  // their own block, which is only reclaimed with the whole arena.
+  static constexpr int kBlockSize = 1 << 16;
+
+  std::vector<std::unique_ptr<uint32_t[]>> blocks_;
+  int num_free_words_in_last_block_ = 0;
+  int64_t num_used_words_ = 0;
+  int64_t num_reserved_words_ = 0;
+
+  // The freed memory indexed by its number of words.
+  std::vector<std::vector<uint32_t*>> free_lists_;
+};
+
 // Clause information used for the clause database management. Note that only
 // the clauses that can be removed have an info. The problem clauses and
 // the learned one that we wants to keep forever do not have one.
@@ -236,16 +301,35 @@ class ClauseManager : public SatPropagator {
     return num_inspected_clause_literals_;
   }
 
+  // Number of ternary clauses skipped without accessing their memory because
+  // the literal stored inline in the watcher was true.
+  int64_t num_ternary_inline_skips() const { return num_ternary_inline_skips_; }
+
   // The number of different literals (always twice the number of variables).
   int64_t literal_size() const { return needs_cleaning_.size().value(); }
 
   // Number of clauses currently watched.
   int64_t num_watched_clauses() const { return num_watched_clauses_; }
 
+  // Number of times the clause memory was compacted, the number of words used
+  // by the clauses and the number of words reserved for them. See
+  // MaybeCompactClauseArena().
+  int64_t num_arena_compactions() const { return num_arena_compactions_; }
+  int64_t num_arena_words() const { return arena_.num_used_words(); }
+  int64_t num_arena_reserved_words() const {
+    return arena_.num_reserved_words();
+  }
+
   void SetDratProofHandler(DratProofHandler* drat_proof_handler) {
     drat_proof_handler_ = drat_proof_handler;
   }
 
+  // Only the deletion of the clauses is notified to this handler. The clauses
+  // and their LRAT hints are added by the SatSolver.
+  void SetLratProofHandler(LratProofHandler* lrat_proof_handler) {
+    lrat_proof_handler_ = lrat_proof_handler;
+  }
+
   // Methods implementing pseudo-iterators over the clause database that are
   // stable across cleanups. They all return nullptr if there are no more
   // clauses.
@@ -275,7 +359,9 @@ class ClauseManager : public SatPropagator {
   // two calls, it is not possible to use the solver unit-progation.
   //
   // Important: When reattach is called, we assume that none of their literal
-  // are fixed, so we don't do any special checks.
+  // are fixed, so we don't do any special checks. Reattaching might also move
+  // the clauses in memory, so any SatClause* kept from before the call is
+  // invalid afterwards.
   //
   // These functions can be called multiple-time and do the right things. This
   // way before doing something, you can call the corresponding function and be
@@ -303,6 +389,20 @@ class ClauseManager : public SatPropagator {
     Watcher(SatClause* c, Literal b, int i = 2)
         : blocking_literal(b), start_index(i), clause(c) {}
 
+    // Watcher for a clause of size 3. The two literals of the clause other
+    // than the watched one are stored inline: the blocking literal and the one
+    // returned by OtherLiteral(). This way, the clause memory is not accessed
+    // if any of them is true.
+    static Watcher ForTernaryClause(SatClause* c, Literal b, Literal other) {
+      return Watcher(c, b, ~other.Index().value());
+    }
+
+    bool IsTernary() const { return start_index < 0; }
+    Literal OtherLiteral() const {
+      DCHECK(IsTernary());
+      return Literal(LiteralIndex(~start_index));
+    }
+
     // Optimization. A literal from the clause that sometimes allow to not even
     // look at the clause memory when true.
     Literal blocking_literal;
@@ -316,6 +416,9 @@ class ClauseManager : public SatPropagator {
     // Note that ideally, this should be part of a SatClause, so it can be
     // shared across watchers. However, since we have 32 bits for "free" here
     // because of the struct alignment, we store it here instead.
+    //
+    // For a ternary clause, the start index is always 2, so we use these bits
+    // to store the complement of the other literal index instead.
     int32_t start_index;
 
     SatClause* clause;
@@ -351,13 +454,22 @@ class ClauseManager : public SatPropagator {
 
   // Attaches the given clause to the event: the given literal becomes false.
   // The blocking_literal can be any literal from the clause, it is used to
-  // speed up PropagateOnFalse() by skipping the clause if it is true.
+  // speed up PropagateOnFalse() by skipping the clause if it is true. For a
+  // clause of size 3, we also store its last literal inline in the watcher.
   void AttachOnFalse(Literal literal, Literal blocking_literal,
                      SatClause* clause);
 
   // Common code between LazyDetach() and Detach().
   void InternalDetach(SatClause* clause);
 
+  // If a large enough fraction of the arena is wasted by deleted or shrunk
+  // clauses, copies all the clauses into a new arena in creation order and
+  // updates all our pointers to them. This must only be called at level zero,
+  // when no clauses are attached and DeleteRemovedClauses() was just called.
+  //
+  // Note that this invalidates any SatClause* held outside of this class.
+  void MaybeCompactClauseArena();
+
   util_intops::StrongVector<LiteralIndex, std::vector<Watcher>>
       watchers_on_false_;
 
@@ -374,18 +486,19 @@ class ClauseManager : public SatPropagator {
 
   int64_t num_inspected_clauses_;
   int64_t num_inspected_clause_literals_;
+  int64_t num_ternary_inline_skips_ = 0;
   int64_t num_watched_clauses_;
   mutable StatsGroup stats_;
 
   // For DetachAllClauses()/AttachAllClauses().
   bool all_clauses_are_attached_ = true;
 
-  // All the clauses currently in memory. This vector has ownership of the
-  // pointers. We currently do not use std::unique_ptr<SatClause> because it
-  // can't be used with some STL algorithms like std::partition.
+  // All the clauses currently in memory. Their memory is owned by arena_.
   //
   // Note that the unit clauses and binary clause are not kept here.
+  ClauseArena arena_;
   std::vector<SatClause*> clauses_;
+  int64_t num_arena_compactions_ = 0;
 
   // TODO(user): If more indices are needed, switch to a generic API.
   int to_minimize_index_ = 0;
@@ -396,6 +509,7 @@ class ClauseManager : public SatPropagator {
   absl::flat_hash_map<SatClause*, ClauseInfo> clauses_info_;
 
   DratProofHandler* drat_proof_handler_ = nullptr;
+  LratProofHandler* lrat_proof_handler_ = nullptr;
 
   absl::AnyInvocable<void(int lbd, absl::Span<const Literal>)>
       add_clause_callback_ = nullptr;
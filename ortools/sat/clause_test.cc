@@ -14,9 +14,11 @@
 #include "ortools/sat/clause.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <random>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -26,6 +28,7 @@
 #include "ortools/base/gmock.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
+#include "ortools/sat/sat_parameters.pb.h"
 #include "ortools/sat/sat_solver.h"
 #include "ortools/util/strong_integers.h"
 
@@ -72,6 +75,144 @@ TEST(SatClauseTest, ClassSize) {
   EXPECT_EQ(4, sizeof(SatClause));
 }
 
+TEST(ClauseArenaTest, ClausesAreContiguous) {
+  ClauseArena arena;
+  SatClause* a = arena.Create(Literals({+1, -2, +4}));
+  SatClause* b = arena.Create(Literals({-1, +3, +5, -6}));
+  EXPECT_THAT(a->AsSpan(), LiteralsAre(+1, -2, +4));
+  EXPECT_THAT(b->AsSpan(), LiteralsAre(-1, +3, +5, -6));
+  // There is one word between the clauses for the allocated size of b.
+  EXPECT_EQ(reinterpret_cast<const char*>(a->end()) + sizeof(uint32_t),
+            reinterpret_cast<const char*>(b));
+  EXPECT_EQ(arena.num_used_words(), 5 + 6);
+}
+
+TEST(ClauseArenaTest, FreedMemoryIsReused) {
+  ClauseArena arena;
+  SatClause* a = arena.Create(Literals({+1, -2, +4}));
+  arena.Create(Literals({-1, +3, +5, -6}));
+  const int64_t num_reserved_words = arena.num_reserved_words();
+
+  arena.Free(a);
+  EXPECT_EQ(arena.num_used_words(), 6);
+  SatClause* c = arena.Create(Literals({+2, +3, +7}));
+  EXPECT_EQ(c, a);
+  EXPECT_THAT(c->AsSpan(), LiteralsAre(+2, +3, +7));
+  EXPECT_EQ(arena.num_used_words(), 5 + 6);
+  EXPECT_EQ(arena.num_reserved_words(), num_reserved_words);
+}
+
+TEST(ClauseManagerTest, ArenaIsCompactedWhenReattaching) {
+  Model model;
+  const int num_variables = 100;
+  model.GetOrCreate<SatSolver>()->SetNumVariables(num_variables);
+  auto* clause_manager = model.GetOrCreate<ClauseManager>();
+
+  const int num_clauses = 20000;
+  std::vector<std::vector<Literal>> clauses;
+  for (int i = 0; i < num_clauses; ++i) {
+    std::vector<Literal> clause;
+    for (int k = 0; k < 5; ++k) {
+      clause.push_back(
+          Literal(BooleanVariable((i + 7 * k) % num_variables), i % 2 == 0));
+    }
+    EXPECT_TRUE(clause_manager->AddClause(clause));
+    clauses.push_back(clause);
+  }
+  EXPECT_EQ(clause_manager->num_arena_words(), num_clauses * 7);
+
+  // Remove 3/4 of the clauses, which makes most of the arena wasted.
+  clause_manager->DetachAllClauses();
+  const std::vector<SatClause*> all_clauses =
+      clause_manager->AllClausesInCreationOrder();
+  for (int i = 0; i < num_clauses; ++i) {
+    if (i % 4 != 0) clause_manager->InprocessingRemoveClause(all_clauses[i]);
+  }
+  clause_manager->AttachAllClauses();
+
+  EXPECT_EQ(clause_manager->num_arena_compactions(), 1);
+  EXPECT_EQ(clause_manager->num_arena_words(), num_clauses / 4 * 7);
+  ASSERT_EQ(clause_manager->num_clauses(), num_clauses / 4);
+  EXPECT_EQ(clause_manager->num_watched_clauses(), num_clauses / 4);
+  for (int i = 0; i < num_clauses / 4; ++i) {
+    EXPECT_THAT(clause_manager->AllClausesInCreationOrder()[i]->AsSpan(),
+                UnorderedElementsAre(clauses[4 * i][0], clauses[4 * i][1],
+                                     clauses[4 * i][2], clauses[4 * i][3],
+                                     clauses[4 * i][4]));
+  }
+}
+
+TEST(ClauseManagerTest, ArenaStaysBoundedWithoutInprocessing) {
+  Model model;
+  SatParameters params;
+  params.set_clause_cleanup_period(1000);
+  params.set_clause_cleanup_target(1000);
+  params.set_max_number_of_conflicts(1000);
+  auto* sat_solver = model.GetOrCreate<SatSolver>();
+  sat_solver->SetParameters(params);
+
+  // A hard random 3-SAT instance. The SatSolver alone never runs the
+  // inprocessing, so the arena is never compacted and only the deleted learned
+  // clauses can be reused.
+  const int num_variables = 300;
+  const int num_clauses = 1278;
+  std::mt19937 random(12345);
+  sat_solver->SetNumVariables(num_variables);
+  for (int i = 0; i < num_clauses; ++i) {
+    std::vector<Literal> clause;
+    for (int k = 0; k < 3; ++k) {
+      clause.push_back(
+          Literal(BooleanVariable(absl::Uniform(random, 0, num_variables)),
+                  absl::Bernoulli(random, 0.5)));
+    }
+    sat_solver->AddProblemClause(clause);
+  }
+
+  auto* clause_manager = model.GetOrCreate<ClauseManager>();
+  int64_t num_reserved_words_after_warmup = 0;
+  for (int round = 0; round < 30; ++round) {
+    if (sat_solver->Solve() != SatSolver::LIMIT_REACHED) break;
+    if (round == 4) {
+      num_reserved_words_after_warmup =
+          clause_manager->num_arena_reserved_words();
+    }
+  }
+  EXPECT_EQ(clause_manager->num_arena_compactions(), 0);
+  if (num_reserved_words_after_warmup > 0) {
+    EXPECT_LE(clause_manager->num_arena_reserved_words(),
+              2 * num_reserved_words_after_warmup);
+  }
+}
+
+TEST(ClauseManagerTest, TernaryClausePropagation) {
+  Model model;
+  auto* sat_solver = model.GetOrCreate<SatSolver>();
+  sat_solver->SetNumVariables(3);
+  EXPECT_TRUE(sat_solver->AddProblemClause(Literals({+1, +2, +3})));
+  auto* clause_manager = model.GetOrCreate<ClauseManager>();
+  const VariablesAssignment& assignment =
+      model.GetOrCreate<Trail>()->Assignment();
+
+  // The last literal is stored inline, so we do not need to look at the
+  // clause when it is true.
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(+3)));
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(-1)));
+  EXPECT_FALSE(assignment.LiteralIsAssigned(Literal(+2)));
+  EXPECT_EQ(clause_manager->num_ternary_inline_skips(), 1);
+
+  sat_solver->Backtrack(0);
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(-1)));
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(-2)));
+  EXPECT_TRUE(assignment.LiteralIsTrue(Literal(+3)));
+  EXPECT_THAT(clause_manager->ReasonClause(2)->PropagationReason(),
+              UnorderedLiteralsAre(+1, +2));
+
+  sat_solver->Backtrack(0);
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(-3)));
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(Literal(-2)));
+  EXPECT_TRUE(assignment.LiteralIsTrue(Literal(+1)));
+}
+
 BinaryClause MakeBinaryClause(int a, int b) {
   return BinaryClause(Literal(a), Literal(b));
 }
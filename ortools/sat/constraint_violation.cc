@@ -18,6 +18,7 @@
 #include <cstdlib>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -124,6 +125,10 @@ bool LiteralValue(int lit, absl::Span<const int64_t> solution) {
 int LinearIncrementalEvaluator::NewConstraint(Domain domain) {
   DCHECK(creation_phase_);
   domains_.push_back(domain);
+  rhs_mins_.push_back(0);
+  rhs_maxs_.push_back(0);
+  rhs_is_interval_.push_back(0);
+  UpdateRhsBounds(num_constraints_);
   offsets_.push_back(0);
   activities_.push_back(0);
   num_false_enforcement_.push_back(0);
@@ -132,6 +137,13 @@ int LinearIncrementalEvaluator::NewConstraint(Domain domain) {
   return num_constraints_++;
 }
 
+void LinearIncrementalEvaluator::UpdateRhsBounds(int c) {
+  const Domain& rhs = domains_[c];
+  rhs_is_interval_[c] = rhs.NumIntervals() == 1;
+  rhs_mins_[c] = rhs.IsEmpty() ? 0 : rhs.Min();
+  rhs_maxs_[c] = rhs.IsEmpty() ? 0 : rhs.Max();
+}
+
 void LinearIncrementalEvaluator::AddEnforcementLiteral(int ct_index, int lit) {
   DCHECK(creation_phase_);
   const int var = PositiveRef(lit);
@@ -231,7 +243,7 @@ void LinearIncrementalEvaluator::ComputeInitialActivities(
     if (value != 0 && data.num_linear_entries > 0) {
       const int* ct_indices =
           &ct_buffer_[data.start + data.num_pos_literal + data.num_neg_literal];
-      const int64_t* coeffs = &coeff_buffer_[data.linear_start];
+      const int64_t* coeffs = coeff_buffer_.data() + data.linear_start;
       for (int k = 0; k < data.num_linear_entries; ++k) {
         activities_[ct_indices[k]] += coeffs[k] * value;
       }
@@ -240,7 +252,7 @@ void LinearIncrementalEvaluator::ComputeInitialActivities(
 
   // Cache violations (not counting enforcement).
   for (int c = 0; c < num_constraints_; ++c) {
-    distances_[c] = domains_[c].Distance(activities_[c]);
+    distances_[c] = DistanceToRhs(c, activities_[c]);
     is_violated_[c] = Violation(c) > 0;
   }
 }
@@ -350,7 +362,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnNewlyEnforced(
       const int var = row_var_buffer_[i];
       const int64_t coeff = row_coeff_buffer_[j];
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * jump_deltas[var]);
+          DistanceToRhs(c, activities_[c] + coeff * jump_deltas[var]);
       jump_scores[var] +=
           weight * static_cast<double>(new_distance - old_distance);
       last_affected_variables_.Set(var);
@@ -388,7 +400,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnNewlyUnenforced(
       const int var = row_var_buffer_[i];
       const int64_t coeff = row_coeff_buffer_[j];
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * jump_deltas[var]);
+          DistanceToRhs(c, activities_[c] + coeff * jump_deltas[var]);
       jump_scores[var] -=
           weight * static_cast<double>(new_distance - old_distance);
       last_affected_variables_.Set(var);
@@ -461,7 +473,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnActivityChange(
   // So it was -weight_time_distance and is now -weight_time_new_distance.
   const double delta =
       -weight *
-      static_cast<double>(domains_[c].Distance(new_activity) - distances_[c]);
+      static_cast<double>(DistanceToRhs(c, new_activity) - distances_[c]);
   if (delta != 0.0) {
     int i = data.start;
     const int end = data.num_pos_literal + data.num_neg_literal;
@@ -505,7 +517,7 @@ void LinearIncrementalEvaluator::UpdateScoreOnActivityChange(
     };
 
     const int64_t old_a_minus_new_a =
-        distances_[c] - domains_[c].Distance(new_activity);
+        distances_[c] - DistanceToRhs(c, new_activity);
     for (int k = 0; k < data.num_linear_entries; ++k) {
       const int var = row_vars[k];
       const int64_t impact = row_coeffs[k] * jump_deltas[var];
@@ -615,7 +627,7 @@ void LinearIncrementalEvaluator::UpdateVariableAndScores(
       // This is the same as the 1->2 transition, but the old 1->0 needs to
       // be changed from - weight * distance to - weight * new_distance.
       const int64_t new_distance =
-          domains_[c].Distance(activities_[c] + coeff * delta);
+          DistanceToRhs(c, activities_[c] + coeff * delta);
       if (new_distance != distances_[c]) {
         UpdateScoreOfEnforcementIncrease(
             c, -weights[c] * static_cast<double>(distances_[c] - new_distance),
@@ -627,7 +639,7 @@ void LinearIncrementalEvaluator::UpdateVariableAndScores(
     }
 
     activities_[c] += coeff * delta;
-    distances_[c] = domains_[c].Distance(activities_[c]);
+    distances_[c] = DistanceToRhs(c, activities_[c]);
     const int64_t v1 = Violation(c);
     is_violated_[c] = v1 > 0;
     if (v1 != v0) {
@@ -652,7 +664,8 @@ bool LinearIncrementalEvaluator::IsViolated(int c) const {
 bool LinearIncrementalEvaluator::ReduceBounds(int c, int64_t lb, int64_t ub) {
   if (domains_[c].Min() >= lb && domains_[c].Max() <= ub) return false;
   domains_[c] = domains_[c].IntersectionWith(Domain(lb, ub));
-  distances_[c] = domains_[c].Distance(activities_[c]);
+  UpdateRhsBounds(c);
+  distances_[c] = DistanceToRhs(c, activities_[c]);
   return true;
 }
 
@@ -708,16 +721,19 @@ double LinearIncrementalEvaluator::WeightedViolationDelta(
     }
   }
 
-  int j = data.linear_start;
+  // This is the hot loop on large models, so we work on the raw arrays.
+  const int* ct_indices = ct_buffer_.data() + i;
+  const int64_t* coeffs = coeff_buffer_.data() + data.linear_start;
+  const int* num_false_enforcement = num_false_enforcement_.data();
+  const int64_t* activities = activities_.data();
+  const int64_t* distances = distances_.data();
   num_ops_ += 2 * data.num_linear_entries;
-  for (int k = 0; k < data.num_linear_entries; ++k, ++i, ++j) {
-    const int c = ct_buffer_[i];
-    if (num_false_enforcement_[c] > 0) continue;
-    const int64_t coeff = coeff_buffer_[j];
-    const int64_t old_distance = distances_[c];
+  for (int k = 0; k < data.num_linear_entries; ++k) {
+    const int c = ct_indices[k];
+    if (num_false_enforcement[c] > 0) continue;
     const int64_t new_distance =
-        domains_[c].Distance(activities_[c] + coeff * delta);
-    result += weights[c] * static_cast<double>(new_distance - old_distance);
+        DistanceToRhs(c, activities[c] + coeffs[k] * delta);
+    result += weights[c] * static_cast<double>(new_distance - distances[c]);
   }
 
   return result;
@@ -1088,6 +1104,41 @@ int64_t CompiledAllDiffConstraint::ComputeViolation(
   return violation;
 }
 
+// ----- CompiledTableConstraint -----
+
+CompiledTableConstraint::CompiledTableConstraint(
+    const ConstraintProto& ct_proto)
+    : CompiledConstraintWithProto(ct_proto) {
+  const int num_exprs = ct_proto.table().exprs_size();
+  const int num_tuples =
+      num_exprs == 0 ? 0 : ct_proto.table().values_size() / num_exprs;
+  sorted_tuples_.resize(num_tuples);
+  std::iota(sorted_tuples_.begin(), sorted_tuples_.end(), 0);
+  std::sort(sorted_tuples_.begin(), sorted_tuples_.end(), [this](int a, int b) {
+    return Tuple(a) < Tuple(b);
+  });
+}
+
+absl::Span<const int64_t> CompiledTableConstraint::Tuple(int t) const {
+  const int num_exprs = ct_proto().table().exprs_size();
+  return absl::MakeConstSpan(ct_proto().table().values().data() + t * num_exprs,
+                             num_exprs);
+}
+
+int64_t CompiledTableConstraint::ComputeViolation(
+    absl::Span<const int64_t> solution) {
+  values_.clear();
+  for (const LinearExpressionProto& expr : ct_proto().table().exprs()) {
+    values_.push_back(ExprValue(expr, solution));
+  }
+  const absl::Span<const int64_t> values = values_;
+  const auto it = std::lower_bound(
+      sorted_tuples_.begin(), sorted_tuples_.end(), values,
+      [this](int t, absl::Span<const int64_t> v) { return Tuple(t) < v; });
+  const bool found = it != sorted_tuples_.end() && Tuple(*it) == values;
+  return found == ct_proto().table().negated() ? 1 : 0;
+}
+
 // ----- CompiledNoOverlapWithTwoIntervals -----
 
 template <bool has_enforcement>
@@ -1607,6 +1658,11 @@ void LsEvaluator::CompileOneConstraint(const ConstraintProto& ct) {
       constraints_.emplace_back(new CompiledAllDiffConstraint(ct));
       break;
     }
+    case ConstraintProto::ConstraintCase::kTable: {
+      // Only the tables kept for the compact table propagator reach this.
+      constraints_.emplace_back(new CompiledTableConstraint(ct));
+      break;
+    }
     case ConstraintProto::ConstraintCase::kLinMax: {
       // This constraint is split into linear precedences and its max
       // maintenance.
@@ -1914,11 +1970,12 @@ void LsEvaluator::UpdateLinearScores(int var, int64_t old_value,
                                      int64_t new_value,
                                      absl::Span<const double> weights,
                                      absl::Span<const int64_t> jump_deltas,
-                                     absl::Span<double> jump_scores) {
+                                     absl::Span<double> jump_scores,
+                                     bool clear_affected_variables) {
   DCHECK(RefIsPositive(var));
   if (old_value == new_value) return;
   last_update_violation_changes_.clear();
-  linear_evaluator_.ClearAffectedVariables();
+  if (clear_affected_variables) linear_evaluator_.ClearAffectedVariables();
   linear_evaluator_.UpdateVariableAndScores(var, new_value - old_value, weights,
                                             jump_deltas, jump_scores,
                                             &last_update_violation_changes_);
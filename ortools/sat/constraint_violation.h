@@ -138,6 +138,15 @@ class LinearIncrementalEvaluator {
     return coeff_buffer_[data.linear_start];
   }
 
+  absl::Span<const int> VarToConstraints(int var) const {
+    if (var >= columns_.size()) return {};
+    const SpanData& data = columns_[var];
+    const int size =
+        data.num_pos_literal + data.num_neg_literal + data.num_linear_entries;
+    if (size == 0) return {};
+    return absl::MakeSpan(&ct_buffer_[data.start], size);
+  }
+
   absl::Span<const int> ConstraintToVars(int c) const {
     const SpanData& data = rows_[c];
     const int size =
@@ -167,17 +176,18 @@ class LinearIncrementalEvaluator {
     int num_linear_entries = 0;
   };
 
-  absl::Span<const int> VarToConstraints(int var) const {
-    if (var >= columns_.size()) return {};
-    const SpanData& data = columns_[var];
-    const int size =
-        data.num_pos_literal + data.num_neg_literal + data.num_linear_entries;
-    if (size == 0) return {};
-    return absl::MakeSpan(&ct_buffer_[data.start], size);
-  }
-
   void ComputeAndCacheDistance(int ct_index);
 
+  // Same as domains_[c].Distance(activity), but most rhs are a single interval
+  // and this avoids scanning the Domain in that case.
+  int64_t DistanceToRhs(int c, int64_t activity) const {
+    if (!rhs_is_interval_[c]) return domains_[c].Distance(activity);
+    if (activity > rhs_maxs_[c]) return activity - rhs_maxs_[c];
+    if (activity < rhs_mins_[c]) return rhs_mins_[c] - activity;
+    return 0;
+  }
+  void UpdateRhsBounds(int c);
+
   // Incremental row-based update.
   void UpdateScoreOnNewlyEnforced(int c, double weight,
                                   absl::Span<const int64_t> jump_deltas,
@@ -197,6 +207,12 @@ class LinearIncrementalEvaluator {
   std::vector<Domain> domains_;
   std::vector<int64_t> offsets_;
 
+  // The bounds of domains_, kept as flat arrays for the hot loops. We use
+  // uint8_t to avoid the bit packing of std::vector<bool>.
+  std::vector<int64_t> rhs_mins_;
+  std::vector<int64_t> rhs_maxs_;
+  std::vector<uint8_t> rhs_is_interval_;
+
   // Variable indexed data.
   // Note that this is just used at construction and is replaced by a compact
   // view when PrecomputeCompactView() is called.
@@ -329,10 +345,15 @@ class LsEvaluator {
                                  absl::Span<const int64_t> new_solution);
 
   // Function specific to the linear only feasibility jump.
+  //
+  // If clear_affected_variables is false, VariablesAffectedByLastLinearUpdate()
+  // will also contain the variables affected by the previous calls, this is
+  // used to process a batch of moves at once.
   void UpdateLinearScores(int var, int64_t old_value, int64_t new_value,
                           absl::Span<const double> weights,
                           absl::Span<const int64_t> jump_deltas,
-                          absl::Span<double> jump_scores);
+                          absl::Span<double> jump_scores,
+                          bool clear_affected_variables = true);
 
   // Must be called after UpdateLinearScores() / UpdateNonLinearViolations()
   // in order to update the ViolatedConstraints().
@@ -541,6 +562,23 @@ class CompiledAllDiffConstraint : public CompiledConstraintWithProto {
   std::vector<int64_t> values_;
 };
 
+// The violation of a table is 1 if the tuple of the expression values is
+// forbidden, and 0 otherwise. The tuples are sorted once so that a lookup is a
+// binary search.
+class CompiledTableConstraint : public CompiledConstraintWithProto {
+ public:
+  explicit CompiledTableConstraint(const ConstraintProto& ct_proto);
+  ~CompiledTableConstraint() override = default;
+
+  int64_t ComputeViolation(absl::Span<const int64_t> solution) override;
+
+ private:
+  absl::Span<const int64_t> Tuple(int t) const;
+
+  std::vector<int> sorted_tuples_;
+  std::vector<int64_t> values_;
+};
+
 // This is more compact and faster to destroy than storing a
 // LinearExpressionProto.
 struct ViewOfAffineLinearExpressionProto {
@@ -13,10 +13,15 @@
 
 #include "ortools/sat/constraint_violation.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
+#include "absl/random/bit_gen_ref.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
 #include "absl/types/span.h"
+#include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
 #include "ortools/base/dump_vars.h"
 #include "ortools/base/gmock.h"
@@ -120,6 +125,94 @@ TEST(LinearEvaluatorTest, EmptyConstraintDoNotCrash) {
                                       absl::MakeSpan(jump_scores));
 }
 
+// Creates a 0-1 model where each constraint has num_terms distinct variables
+// with small coefficients and a random single interval rhs.
+void FillRandomBooleanEvaluator(int num_vars, int num_constraints,
+                                int num_terms, absl::BitGenRef random,
+                                LinearIncrementalEvaluator* evaluator) {
+  std::vector<int> vars(num_vars);
+  for (int var = 0; var < num_vars; ++var) vars[var] = var;
+  for (int c = 0; c < num_constraints; ++c) {
+    const int64_t lb = absl::Uniform<int64_t>(random, -num_terms, num_terms);
+    const int64_t ub = lb + absl::Uniform<int64_t>(random, 0, num_terms);
+    evaluator->NewConstraint({lb, ub});
+    std::shuffle(vars.begin(), vars.end(), random);
+    for (int k = 0; k < num_terms; ++k) {
+      int64_t coeff = absl::Uniform<int64_t>(random, -3, 3);
+      if (coeff == 0) coeff = 1;
+      evaluator->AddTerm(c, vars[k], coeff);
+    }
+  }
+  evaluator->PrecomputeCompactView(std::vector<int64_t>(num_vars, 1));
+}
+
+TEST(LinearEvaluatorTest, IncrementalScoresOnRandomBooleanModel) {
+  absl::BitGen random;
+  const int num_vars = 20;
+  LinearIncrementalEvaluator evaluator;
+  FillRandomBooleanEvaluator(num_vars, /*num_constraints=*/15,
+                             /*num_terms=*/5, random, &evaluator);
+
+  // Integer weights keep all the score computations exact.
+  std::vector<double> weights(15);
+  for (double& w : weights) w = absl::Uniform<int>(random, 1, 5);
+  std::vector<int64_t> solution(num_vars);
+  std::vector<int64_t> jump_deltas(num_vars);
+  std::vector<double> jump_scores(num_vars);
+  std::vector<int> modified_constraints;
+  for (int var = 0; var < num_vars; ++var) {
+    solution[var] = absl::Bernoulli(random, 0.5);
+    jump_deltas[var] = 1 - 2 * solution[var];
+  }
+  evaluator.ComputeInitialActivities(solution);
+  for (int var = 0; var < num_vars; ++var) {
+    jump_scores[var] =
+        evaluator.WeightedViolationDelta(weights, var, jump_deltas[var]);
+  }
+
+  for (int step = 0; step < 200; ++step) {
+    const int move = absl::Uniform<int>(random, 0, num_vars);
+    evaluator.UpdateVariableAndScores(move, jump_deltas[move], weights,
+                                      jump_deltas, absl::MakeSpan(jump_scores),
+                                      &modified_constraints);
+    solution[move] = 1 - solution[move];
+    jump_deltas[move] = -jump_deltas[move];
+    jump_scores[move] =
+        evaluator.WeightedViolationDelta(weights, move, jump_deltas[move]);
+    for (int var = 0; var < num_vars; ++var) {
+      ASSERT_EQ(jump_scores[var], evaluator.WeightedViolationDelta(
+                                      weights, var, jump_deltas[var]))
+          << DUMP_VARS(step) << "\n"
+          << DUMP_VARS(var);
+    }
+  }
+}
+
+TEST(LinearEvaluatorTest, WeightedViolationDeltaWithHolesInRhs) {
+  LinearIncrementalEvaluator evaluator;
+  evaluator.NewConstraint(Domain::FromValues({0, 3, 6}));
+  for (int var = 0; var < 4; ++var) evaluator.AddTerm(0, var, 2);
+  evaluator.PrecomputeCompactView({1, 1, 1, 1});
+
+  const std::vector<double> weights{1.0};
+  for (int sol = 0; sol < 16; ++sol) {
+    std::vector<int64_t> solution(4);
+    for (int var = 0; var < 4; ++var) solution[var] = (sol >> var) & 1;
+    evaluator.ComputeInitialActivities(solution);
+    const int64_t violation = evaluator.Violation(0);
+    for (int var = 0; var < 4; ++var) {
+      const int64_t delta = 1 - 2 * solution[var];
+      const double score =
+          evaluator.WeightedViolationDelta(weights, var, delta);
+      solution[var] += delta;
+      evaluator.ComputeInitialActivities(solution);
+      EXPECT_EQ(score, evaluator.Violation(0) - violation);
+      solution[var] -= delta;
+      evaluator.ComputeInitialActivities(solution);
+    }
+  }
+}
+
 TEST(ConstraintViolationTest, BasicExactlyOneExampleNonViolated) {
   const CpModelProto model = ParseTestProto(R"pb(
     variables { domain: [ 0, 1 ] }
@@ -742,6 +835,38 @@ TEST(ConstraintViolationTest, LastUpdateViolationChanges) {
   EXPECT_THAT(ls.last_update_violation_changes(), ElementsAre(1));
 }
 
+// Reports the number of flips per second, each flip being evaluated first as
+// in the feasibility jump inner loop.
+static void BM_LinearEvaluatorBooleanFlips(benchmark::State& state) {
+  absl::BitGen random;
+  const int num_vars = state.range(0);
+  const int num_constraints = 4 * num_vars;
+  LinearIncrementalEvaluator evaluator;
+  FillRandomBooleanEvaluator(num_vars, num_constraints, /*num_terms=*/10,
+                             random, &evaluator);
+
+  const std::vector<double> weights(num_constraints, 1.0);
+  std::vector<int64_t> solution(num_vars, 0);
+  std::vector<int64_t> jump_deltas(num_vars, 1);
+  std::vector<double> jump_scores(num_vars, 0.0);
+  std::vector<int> modified_constraints;
+  evaluator.ComputeInitialActivities(solution);
+  int move = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        evaluator.WeightedViolationDelta(weights, move, jump_deltas[move]));
+    modified_constraints.clear();
+    evaluator.UpdateVariableAndScores(move, jump_deltas[move], weights,
+                                      jump_deltas, absl::MakeSpan(jump_scores),
+                                      &modified_constraints);
+    jump_deltas[move] = -jump_deltas[move];
+    if (++move == num_vars) move = 0;
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_LinearEvaluatorBooleanFlips)->Arg(1000)->Arg(100000);
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
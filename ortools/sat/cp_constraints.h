@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <string>
 #include <vector>
 
 #include "absl/log/check.h"
@@ -47,6 +48,7 @@ class BooleanXorPropagator : public PropagatorInterface {
   BooleanXorPropagator(const BooleanXorPropagator&) = delete;
   BooleanXorPropagator& operator=(const BooleanXorPropagator&) = delete;
 
+  std::string Name() const final { return "BooleanXorPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -83,6 +85,7 @@ class GreaterThanAtLeastOneOfPropagator : public PropagatorInterface,
   GreaterThanAtLeastOneOfPropagator& operator=(
       const GreaterThanAtLeastOneOfPropagator&) = delete;
 
+  std::string Name() const final { return "GreaterThanAtLeastOneOfPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -0,0 +1,593 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/cp_model_columnar.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif  // !defined(_WIN32)
+
+#include "absl/base/config.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "ortools/base/helpers.h"
+#include "ortools/base/options.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'P', 'S', 'A', 'T', 'C', 'O', 'L'};
+constexpr uint32_t kVersion = 1;
+
+// The magic, the version and the number of sections, followed by the size in
+// bytes of each section.
+constexpr size_t kFixedHeaderSize = 16;
+
+// The sections, in the order in which they appear in the data.
+enum Section {
+  kVariableDomainStarts,
+  kVariableDomainValues,
+  kConstraintSources,
+  kLinearEnforcementStarts,
+  kLinearEnforcementLiterals,
+  kLinearTermStarts,
+  kLinearVars,
+  kLinearCoeffs,
+  kLinearDomainStarts,
+  kLinearDomainValues,
+  kIntervalEnforcementStarts,
+  kIntervalEnforcementLiterals,
+  kExpressionTermStarts,
+  kExpressionVars,
+  kExpressionCoeffs,
+  kExpressionOffsets,
+  kRemainder,
+  kNumSections,
+};
+
+// A constraint source is (index << 2) | kind, where index is the position of
+// the constraint in the remainder or in the sections of its kind.
+enum ConstraintSourceKind {
+  kFromRemainder = 0,
+  kFromLinear = 1,
+  kFromInterval = 2,
+};
+
+size_t PaddedSize(size_t size) { return (size + 7) & ~size_t{7}; }
+
+bool IsColumnarLinear(const ConstraintProto& ct) {
+  return ct.constraint_case() == ConstraintProto::kLinear &&
+         ct.name().empty() &&
+         ct.linear().vars_size() == ct.linear().coeffs_size();
+}
+
+bool IsColumnarExpression(const LinearExpressionProto& expr) {
+  return expr.vars_size() == expr.coeffs_size();
+}
+
+bool IsColumnarInterval(const ConstraintProto& ct) {
+  if (ct.constraint_case() != ConstraintProto::kInterval) return false;
+  if (!ct.name().empty()) return false;
+  const IntervalConstraintProto& interval = ct.interval();
+  return interval.has_start() && interval.has_end() && interval.has_size() &&
+         IsColumnarExpression(interval.start()) &&
+         IsColumnarExpression(interval.end()) &&
+         IsColumnarExpression(interval.size());
+}
+
+// The content of the sections before they are written.
+struct ColumnarModel {
+  std::vector<int64_t> variable_domain_starts = {0};
+  std::vector<int64_t> variable_domain_values;
+  std::vector<int64_t> constraint_sources;
+  std::vector<int64_t> linear_enforcement_starts = {0};
+  std::vector<int32_t> linear_enforcement_literals;
+  std::vector<int64_t> linear_term_starts = {0};
+  std::vector<int32_t> linear_vars;
+  std::vector<int64_t> linear_coeffs;
+  std::vector<int64_t> linear_domain_starts = {0};
+  std::vector<int64_t> linear_domain_values;
+  std::vector<int64_t> interval_enforcement_starts = {0};
+  std::vector<int32_t> interval_enforcement_literals;
+  std::vector<int64_t> expression_term_starts = {0};
+  std::vector<int32_t> expression_vars;
+  std::vector<int64_t> expression_coeffs;
+  std::vector<int64_t> expression_offsets;
+  std::string remainder;
+
+  void AddExpression(const LinearExpressionProto& expr) {
+    expression_vars.insert(expression_vars.end(), expr.vars().begin(),
+                           expr.vars().end());
+    expression_coeffs.insert(expression_coeffs.end(), expr.coeffs().begin(),
+                             expr.coeffs().end());
+    expression_term_starts.push_back(expression_vars.size());
+    expression_offsets.push_back(expr.offset());
+  }
+};
+
+template <typename T>
+absl::string_view AsBytes(const std::vector<T>& values) {
+  return absl::string_view(reinterpret_cast<const char*>(values.data()),
+                           values.size() * sizeof(T));
+}
+
+template <typename T>
+absl::Span<const T> BytesAs(absl::string_view bytes) {
+  return absl::MakeConstSpan(reinterpret_cast<const T*>(bytes.data()),
+                             bytes.size() / sizeof(T));
+}
+
+// Checks that starts is a valid list of offsets in an array of num_values
+// elements, with one more offset than the number of elements it describes.
+absl::Status CheckStarts(absl::Span<const int64_t> starts, size_t num_values,
+                         Section section) {
+  if (starts.empty() || starts.front() != 0 ||
+      starts.back() != static_cast<int64_t>(num_values)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Invalid bounds of the offsets in section ", section));
+  }
+  for (int i = 1; i < starts.size(); ++i) {
+    if (starts[i] < starts[i - 1]) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Decreasing offsets in section ", section));
+    }
+  }
+  return absl::OkStatus();
+}
+
+}  // namespace
+
+absl::Status WriteColumnarModel(const CpModelProto& model_proto,
+                                std::string* output) {
+#if defined(ABSL_IS_BIG_ENDIAN)
+  return absl::UnimplementedError(
+      "The columnar model format is not supported on big endian platforms.");
+#endif  // defined(ABSL_IS_BIG_ENDIAN)
+  ColumnarModel columns;
+
+  bool has_variable_names = false;
+  for (const IntegerVariableProto& var : model_proto.variables()) {
+    columns.variable_domain_values.insert(columns.variable_domain_values.end(),
+                                          var.domain().begin(),
+                                          var.domain().end());
+    columns.variable_domain_starts.push_back(
+        columns.variable_domain_values.size());
+    if (!var.name().empty()) has_variable_names = true;
+  }
+
+  // We copy everything except the variables and the constraints, which can be
+  // large and are added below.
+  CpModelProto remainder;
+  remainder.set_name(model_proto.name());
+  if (model_proto.has_objective()) {
+    *remainder.mutable_objective() = model_proto.objective();
+  }
+  if (model_proto.has_floating_point_objective()) {
+    *remainder.mutable_floating_point_objective() =
+        model_proto.floating_point_objective();
+  }
+  *remainder.mutable_search_strategy() = model_proto.search_strategy();
+  if (model_proto.has_solution_hint()) {
+    *remainder.mutable_solution_hint() = model_proto.solution_hint();
+  }
+  *remainder.mutable_assumptions() = model_proto.assumptions();
+  if (model_proto.has_symmetry()) {
+    *remainder.mutable_symmetry() = model_proto.symmetry();
+  }
+  if (has_variable_names) {
+    for (const IntegerVariableProto& var : model_proto.variables()) {
+      remainder.add_variables()->set_name(var.name());
+    }
+  }
+
+  int num_linears = 0;
+  int num_intervals = 0;
+  for (const ConstraintProto& ct : model_proto.constraints()) {
+    if (IsColumnarLinear(ct)) {
+      columns.constraint_sources.push_back(
+          (int64_t{num_linears++} << 2) | kFromLinear);
+      columns.linear_enforcement_literals.insert(
+          columns.linear_enforcement_literals.end(),
+          ct.enforcement_literal().begin(), ct.enforcement_literal().end());
+      columns.linear_enforcement_starts.push_back(
+          columns.linear_enforcement_literals.size());
+      const LinearConstraintProto& linear = ct.linear();
+      columns.linear_vars.insert(columns.linear_vars.end(),
+                                 linear.vars().begin(), linear.vars().end());
+      columns.linear_coeffs.insert(columns.linear_coeffs.end(),
+                                   linear.coeffs().begin(),
+                                   linear.coeffs().end());
+      columns.linear_term_starts.push_back(columns.linear_vars.size());
+      columns.linear_domain_values.insert(columns.linear_domain_values.end(),
+                                          linear.domain().begin(),
+                                          linear.domain().end());
+      columns.linear_domain_starts.push_back(
+          columns.linear_domain_values.size());
+    } else if (IsColumnarInterval(ct)) {
+      columns.constraint_sources.push_back(
+          (int64_t{num_intervals++} << 2) | kFromInterval);
+      columns.interval_enforcement_literals.insert(
+          columns.interval_enforcement_literals.end(),
+          ct.enforcement_literal().begin(), ct.enforcement_literal().end());
+      columns.interval_enforcement_starts.push_back(
+          columns.interval_enforcement_literals.size());
+      columns.AddExpression(ct.interval().start());
+      columns.AddExpression(ct.interval().end());
+      columns.AddExpression(ct.interval().size());
+    } else {
+      columns.constraint_sources.push_back(
+          (int64_t{remainder.constraints_size()} << 2) | kFromRemainder);
+      *remainder.add_constraints() = ct;
+    }
+  }
+  if (!remainder.SerializeToString(&columns.remainder)) {
+    return absl::InternalError("Cannot serialize the model remainder.");
+  }
+
+  const absl::string_view sections[kNumSections] = {
+      AsBytes(columns.variable_domain_starts),
+      AsBytes(columns.variable_domain_values),
+      AsBytes(columns.constraint_sources),
+      AsBytes(columns.linear_enforcement_starts),
+      AsBytes(columns.linear_enforcement_literals),
+      AsBytes(columns.linear_term_starts),
+      AsBytes(columns.linear_vars),
+      AsBytes(columns.linear_coeffs),
+      AsBytes(columns.linear_domain_starts),
+      AsBytes(columns.linear_domain_values),
+      AsBytes(columns.interval_enforcement_starts),
+      AsBytes(columns.interval_enforcement_literals),
+      AsBytes(columns.expression_term_starts),
+      AsBytes(columns.expression_vars),
+      AsBytes(columns.expression_coeffs),
+      AsBytes(columns.expression_offsets),
+      columns.remainder,
+  };
+
+  size_t total_size = kFixedHeaderSize + kNumSections * sizeof(uint64_t);
+  for (const absl::string_view section : sections) {
+    total_size += PaddedSize(section.size());
+  }
+  output->clear();
+  output->reserve(total_size);
+  output->append(kMagic, sizeof(kMagic));
+  const uint32_t fixed_header[2] = {kVersion, kNumSections};
+  output->append(reinterpret_cast<const char*>(fixed_header),
+                 sizeof(fixed_header));
+  for (const absl::string_view section : sections) {
+    const uint64_t size = section.size();
+    output->append(reinterpret_cast<const char*>(&size), sizeof(size));
+  }
+  for (const absl::string_view section : sections) {
+    output->append(section.data(), section.size());
+    output->append(PaddedSize(section.size()) - section.size(), '\0');
+  }
+  return absl::OkStatus();
+}
+
+absl::Status WriteColumnarModelToFile(const CpModelProto& model_proto,
+                                      absl::string_view filename) {
+  std::string data;
+  const absl::Status status = WriteColumnarModel(model_proto, &data);
+  if (!status.ok()) return status;
+  return file::SetContents(filename, data, file::Defaults());
+}
+
+absl::StatusOr<CpModelColumnarView> CpModelColumnarView::Create(
+    absl::string_view data) {
+#if defined(ABSL_IS_BIG_ENDIAN)
+  return absl::UnimplementedError(
+      "The columnar model format is not supported on big endian platforms.");
+#endif  // defined(ABSL_IS_BIG_ENDIAN)
+  if (reinterpret_cast<uintptr_t>(data.data()) % 8 != 0) {
+    return absl::InvalidArgumentError(
+        "The columnar model data must be aligned on 8 bytes.");
+  }
+  const size_t header_size =
+      kFixedHeaderSize + kNumSections * sizeof(uint64_t);
+  if (data.size() < header_size ||
+      memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+    return absl::InvalidArgumentError("Not a columnar model.");
+  }
+  uint32_t fixed_header[2];
+  memcpy(fixed_header, data.data() + sizeof(kMagic), sizeof(fixed_header));
+  if (fixed_header[0] != kVersion || fixed_header[1] != kNumSections) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Unsupported columnar model version: ", fixed_header[0]));
+  }
+
+  absl::string_view sections[kNumSections];
+  const absl::Span<const uint64_t> sizes =
+      BytesAs<uint64_t>(data.substr(kFixedHeaderSize,
+                                    kNumSections * sizeof(uint64_t)));
+  size_t offset = header_size;
+  for (int i = 0; i < kNumSections; ++i) {
+    if (sizes[i] > data.size() - offset ||
+        PaddedSize(sizes[i]) > data.size() - offset) {
+      return absl::InvalidArgumentError("Truncated columnar model.");
+    }
+    sections[i] = data.substr(offset, sizes[i]);
+    offset += PaddedSize(sizes[i]);
+  }
+  if (offset != data.size()) {
+    return absl::InvalidArgumentError("Trailing data in the columnar model.");
+  }
+  for (int i = 0; i < kRemainder; ++i) {
+    const bool is_int32 = i == kLinearEnforcementLiterals ||
+                          i == kLinearVars ||
+                          i == kIntervalEnforcementLiterals ||
+                          i == kExpressionVars;
+    if (sections[i].size() % (is_int32 ? 4 : 8) != 0) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid size of section ", i));
+    }
+  }
+
+  CpModelColumnarView view;
+  view.variable_domain_starts_ =
+      BytesAs<int64_t>(sections[kVariableDomainStarts]);
+  view.variable_domain_values_ =
+      BytesAs<int64_t>(sections[kVariableDomainValues]);
+  view.constraint_sources_ = BytesAs<int64_t>(sections[kConstraintSources]);
+  view.linear_enforcement_starts_ =
+      BytesAs<int64_t>(sections[kLinearEnforcementStarts]);
+  view.linear_enforcement_literals_ =
+      BytesAs<int32_t>(sections[kLinearEnforcementLiterals]);
+  view.linear_term_starts_ = BytesAs<int64_t>(sections[kLinearTermStarts]);
+  view.linear_vars_ = BytesAs<int32_t>(sections[kLinearVars]);
+  view.linear_coeffs_ = BytesAs<int64_t>(sections[kLinearCoeffs]);
+  view.linear_domain_starts_ = BytesAs<int64_t>(sections[kLinearDomainStarts]);
+  view.linear_domain_values_ = BytesAs<int64_t>(sections[kLinearDomainValues]);
+  view.interval_enforcement_starts_ =
+      BytesAs<int64_t>(sections[kIntervalEnforcementStarts]);
+  view.interval_enforcement_literals_ =
+      BytesAs<int32_t>(sections[kIntervalEnforcementLiterals]);
+  view.expression_term_starts_ =
+      BytesAs<int64_t>(sections[kExpressionTermStarts]);
+  view.expression_vars_ = BytesAs<int32_t>(sections[kExpressionVars]);
+  view.expression_coeffs_ = BytesAs<int64_t>(sections[kExpressionCoeffs]);
+  view.expression_offsets_ = BytesAs<int64_t>(sections[kExpressionOffsets]);
+
+  // Check the offsets so that the accessors never read out of bounds.
+  const std::pair<Section, size_t> starts_and_sizes[] = {
+      {kVariableDomainStarts, view.variable_domain_values_.size()},
+      {kLinearEnforcementStarts, view.linear_enforcement_literals_.size()},
+      {kLinearTermStarts, view.linear_vars_.size()},
+      {kLinearTermStarts, view.linear_coeffs_.size()},
+      {kLinearDomainStarts, view.linear_domain_values_.size()},
+      {kIntervalEnforcementStarts,
+       view.interval_enforcement_literals_.size()},
+      {kExpressionTermStarts, view.expression_vars_.size()},
+      {kExpressionTermStarts, view.expression_coeffs_.size()},
+  };
+  for (const auto& [section, num_values] : starts_and_sizes) {
+    const absl::Status status =
+        CheckStarts(BytesAs<int64_t>(sections[section]), num_values, section);
+    if (!status.ok()) return status;
+  }
+  const size_t num_linears = view.linear_term_starts_.size() - 1;
+  const size_t num_intervals = view.interval_enforcement_starts_.size() - 1;
+  if (view.linear_enforcement_starts_.size() != num_linears + 1 ||
+      view.linear_domain_starts_.size() != num_linears + 1 ||
+      view.expression_term_starts_.size() != 3 * num_intervals + 1 ||
+      view.expression_offsets_.size() != 3 * num_intervals) {
+    return absl::InvalidArgumentError(
+        "Inconsistent number of linear or interval constraints.");
+  }
+
+  view.remainder_ = std::make_unique<CpModelProto>();
+  if (!view.remainder_->ParseFromArray(sections[kRemainder].data(),
+                                       sections[kRemainder].size())) {
+    return absl::InvalidArgumentError("Cannot parse the model remainder.");
+  }
+  if (!view.remainder_->variables().empty() &&
+      view.remainder_->variables_size() != view.num_variables()) {
+    return absl::InvalidArgumentError("Invalid number of variable names.");
+  }
+  for (const int64_t source : view.constraint_sources_) {
+    const int64_t index = source >> 2;
+    size_t num_sources = 0;
+    switch (source & 3) {
+      case kFromRemainder:
+        num_sources = view.remainder_->constraints_size();
+        break;
+      case kFromLinear:
+        num_sources = num_linears;
+        break;
+      case kFromInterval:
+        num_sources = num_intervals;
+        break;
+    }
+    if (index < 0 || index >= static_cast<int64_t>(num_sources)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid constraint source: ", source));
+    }
+  }
+  return view;
+}
+
+Domain CpModelColumnarView::VariableDomain(int var) const {
+  return Domain::FromFlatSpanOfIntervals(VariableDomainValues(var));
+}
+
+void CpModelColumnarView::FillExpression(int index,
+                                         LinearExpressionProto* expr) const {
+  const absl::Span<const int32_t> vars =
+      Slice(expression_vars_, expression_term_starts_, index);
+  const absl::Span<const int64_t> coeffs =
+      Slice(expression_coeffs_, expression_term_starts_, index);
+  expr->mutable_vars()->Assign(vars.begin(), vars.end());
+  expr->mutable_coeffs()->Assign(coeffs.begin(), coeffs.end());
+  expr->set_offset(expression_offsets_[index]);
+}
+
+void CpModelColumnarView::FillLinear(int index, ConstraintProto* ct) const {
+  const absl::Span<const int32_t> enforcement =
+      Slice(linear_enforcement_literals_, linear_enforcement_starts_, index);
+  ct->mutable_enforcement_literal()->Assign(enforcement.begin(),
+                                            enforcement.end());
+  LinearConstraintProto* linear = ct->mutable_linear();
+  const absl::Span<const int32_t> vars =
+      Slice(linear_vars_, linear_term_starts_, index);
+  const absl::Span<const int64_t> coeffs =
+      Slice(linear_coeffs_, linear_term_starts_, index);
+  const absl::Span<const int64_t> domain =
+      Slice(linear_domain_values_, linear_domain_starts_, index);
+  linear->mutable_vars()->Assign(vars.begin(), vars.end());
+  linear->mutable_coeffs()->Assign(coeffs.begin(), coeffs.end());
+  linear->mutable_domain()->Assign(domain.begin(), domain.end());
+}
+
+void CpModelColumnarView::FillInterval(int index, ConstraintProto* ct) const {
+  const absl::Span<const int32_t> enforcement = Slice(
+      interval_enforcement_literals_, interval_enforcement_starts_, index);
+  ct->mutable_enforcement_literal()->Assign(enforcement.begin(),
+                                            enforcement.end());
+  IntervalConstraintProto* interval = ct->mutable_interval();
+  FillExpression(3 * index, interval->mutable_start());
+  FillExpression(3 * index + 1, interval->mutable_end());
+  FillExpression(3 * index + 2, interval->mutable_size());
+}
+
+void CpModelColumnarView::FillConstraint(int c, ConstraintProto* ct) const {
+  ct->Clear();
+  const int64_t source = constraint_sources_[c];
+  const int index = static_cast<int>(source >> 2);
+  switch (source & 3) {
+    case kFromRemainder:
+      *ct = remainder_->constraints(index);
+      break;
+    case kFromLinear:
+      FillLinear(index, ct);
+      break;
+    case kFromInterval:
+      FillInterval(index, ct);
+      break;
+  }
+}
+
+void CpModelColumnarView::FillCpModelProto(CpModelProto* model_proto) const {
+  model_proto->Clear();
+  const CpModelProto& remainder = *remainder_;
+  model_proto->set_name(remainder.name());
+  if (remainder.has_objective()) {
+    *model_proto->mutable_objective() = remainder.objective();
+  }
+  if (remainder.has_floating_point_objective()) {
+    *model_proto->mutable_floating_point_objective() =
+        remainder.floating_point_objective();
+  }
+  *model_proto->mutable_search_strategy() = remainder.search_strategy();
+  if (remainder.has_solution_hint()) {
+    *model_proto->mutable_solution_hint() = remainder.solution_hint();
+  }
+  *model_proto->mutable_assumptions() = remainder.assumptions();
+  if (remainder.has_symmetry()) {
+    *model_proto->mutable_symmetry() = remainder.symmetry();
+  }
+
+  const int num_variables = this->num_variables();
+  model_proto->mutable_variables()->Reserve(num_variables);
+  for (int var = 0; var < num_variables; ++var) {
+    IntegerVariableProto* var_proto = model_proto->add_variables();
+    if (!remainder.variables().empty()) {
+      *var_proto = remainder.variables(var);
+    }
+    const absl::Span<const int64_t> domain = VariableDomainValues(var);
+    var_proto->mutable_domain()->Assign(domain.begin(), domain.end());
+  }
+
+  const int num_constraints = this->num_constraints();
+  model_proto->mutable_constraints()->Reserve(num_constraints);
+  for (int c = 0; c < num_constraints; ++c) {
+    FillConstraint(c, model_proto->add_constraints());
+  }
+}
+
+absl::StatusOr<std::unique_ptr<CpModelColumnarFile>> CpModelColumnarFile::Open(
+    const std::string& filename) {
+  std::unique_ptr<CpModelColumnarFile> file(new CpModelColumnarFile());
+  absl::string_view data;
+#if !defined(_WIN32)
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return absl::NotFoundError(
+        absl::StrCat("Cannot open '", filename, "': ", strerror(errno)));
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    const absl::Status status = absl::InternalError(
+        absl::StrCat("Cannot stat '", filename, "': ", strerror(errno)));
+    close(fd);
+    return status;
+  }
+  file->size_in_bytes_ = file_stat.st_size;
+  if (file->size_in_bytes_ > 0) {
+    void* mapped =
+        mmap(nullptr, file->size_in_bytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped == MAP_FAILED) {
+      const absl::Status status = absl::InternalError(
+          absl::StrCat("Cannot map '", filename, "': ", strerror(errno)));
+      close(fd);
+      return status;
+    }
+    file->mapped_data_ = mapped;
+    data = absl::string_view(static_cast<const char*>(mapped),
+                             file->size_in_bytes_);
+  }
+  // The mapping stays valid after the file is closed.
+  close(fd);
+#else
+  absl::StatusOr<std::string> content =
+      file::GetContents(filename, file::Defaults());
+  if (!content.ok()) return content.status();
+  file->size_in_bytes_ = content->size();
+  file->buffer_.resize((content->size() + 7) / 8);
+  memcpy(file->buffer_.data(), content->data(), content->size());
+  data = absl::string_view(reinterpret_cast<const char*>(file->buffer_.data()),
+                           file->size_in_bytes_);
+#endif  // !defined(_WIN32)
+
+  absl::StatusOr<CpModelColumnarView> view = CpModelColumnarView::Create(data);
+  if (!view.ok()) return view.status();
+  file->view_ = std::make_unique<CpModelColumnarView>(*std::move(view));
+  return file;
+}
+
+CpModelColumnarFile::~CpModelColumnarFile() {
+#if !defined(_WIN32)
+  if (mapped_data_ != nullptr) munmap(mapped_data_, size_in_bytes_);
+#endif  // !defined(_WIN32)
+}
+
+}  // namespace sat
+}  // namespace operations_research
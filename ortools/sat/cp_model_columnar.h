@@ -0,0 +1,158 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_CP_MODEL_COLUMNAR_H_
+#define OR_TOOLS_SAT_CP_MODEL_COLUMNAR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+
+// A compact binary format for the CpModelProto where the variable domains, the
+// linear constraints and the interval constraints are stored as flat arrays of
+// integers. These arrays are used in place, for instance directly from the
+// pages of a memory-mapped file, so a model can be inspected without parsing
+// it, and a CpModelProto can be built from it without keeping the serialized
+// message in memory nor going through the protobuf wire format.
+//
+// The data is a small header followed by a fixed list of sections, each one is
+// an array of native little endian integers padded to a multiple of 8 bytes.
+// Everything that is not stored in the arrays (names, objective, hint, all the
+// other constraints, ...) is kept in a serialized CpModelProto, the remainder,
+// which is parsed when the view is created. A linear or interval constraint
+// with a name also goes in the remainder.
+//
+// Files in this format use the ".cpcol" extension by convention.
+
+// Serializes the given model in the columnar format. This fails on big endian
+// platforms, which are not supported.
+absl::Status WriteColumnarModel(const CpModelProto& model_proto,
+                                std::string* output);
+absl::Status WriteColumnarModelToFile(const CpModelProto& model_proto,
+                                      absl::string_view filename);
+
+// A read-only view of a model in the columnar format. The data must outlive
+// the view and start at an address aligned on 8 bytes.
+class CpModelColumnarView {
+ public:
+  // Checks the header and the section sizes, but not the content of the model:
+  // a valid view can still contain an invalid model, as a CpModelProto can.
+  static absl::StatusOr<CpModelColumnarView> Create(absl::string_view data);
+
+  int num_variables() const { return variable_domain_starts_.size() - 1; }
+  int num_constraints() const { return constraint_sources_.size(); }
+
+  // The domain of the given variable in the format of
+  // IntegerVariableProto::domain, as a sorted list of disjoint intervals.
+  absl::Span<const int64_t> VariableDomainValues(int var) const {
+    return Slice(variable_domain_values_, variable_domain_starts_, var);
+  }
+  Domain VariableDomain(int var) const;
+
+  // Fills the given constraint, which is cleared first.
+  void FillConstraint(int c, ConstraintProto* ct) const;
+
+  // Fills the given model with the full model, it is cleared first.
+  void FillCpModelProto(CpModelProto* model_proto) const;
+
+  // The fields that are not stored in the columnar sections. Its constraints
+  // appear in the model in this order, interleaved with the columnar ones.
+  const CpModelProto& remainder() const { return *remainder_; }
+
+ private:
+  CpModelColumnarView() = default;
+
+  template <typename T>
+  static absl::Span<const T> Slice(absl::Span<const T> values,
+                                   absl::Span<const int64_t> starts,
+                                   int index) {
+    return values.subspan(starts[index], starts[index + 1] - starts[index]);
+  }
+
+  void FillLinear(int index, ConstraintProto* ct) const;
+  void FillInterval(int index, ConstraintProto* ct) const;
+  void FillExpression(int index, LinearExpressionProto* expr) const;
+
+  absl::Span<const int64_t> variable_domain_starts_;
+  absl::Span<const int64_t> variable_domain_values_;
+
+  // For each constraint of the model, its index in the remainder or in the
+  // linear or interval sections, see kConstraintSources in the .cc.
+  absl::Span<const int64_t> constraint_sources_;
+
+  absl::Span<const int64_t> linear_enforcement_starts_;
+  absl::Span<const int32_t> linear_enforcement_literals_;
+  absl::Span<const int64_t> linear_term_starts_;
+  absl::Span<const int32_t> linear_vars_;
+  absl::Span<const int64_t> linear_coeffs_;
+  absl::Span<const int64_t> linear_domain_starts_;
+  absl::Span<const int64_t> linear_domain_values_;
+
+  // The expressions of the interval i are the start, end and size at index 3i,
+  // 3i + 1 and 3i + 2 of the expression sections.
+  absl::Span<const int64_t> interval_enforcement_starts_;
+  absl::Span<const int32_t> interval_enforcement_literals_;
+  absl::Span<const int64_t> expression_term_starts_;
+  absl::Span<const int32_t> expression_vars_;
+  absl::Span<const int64_t> expression_coeffs_;
+  absl::Span<const int64_t> expression_offsets_;
+
+  // This is a pointer so that the view is cheap to move.
+  std::unique_ptr<CpModelProto> remainder_;
+};
+
+// A model in the columnar format read from a file. On POSIX systems, the file
+// is memory-mapped so that its pages are shared with the page cache and can be
+// dropped by the kernel under memory pressure. Otherwise it is read in memory.
+class CpModelColumnarFile {
+ public:
+  static absl::StatusOr<std::unique_ptr<CpModelColumnarFile>> Open(
+      const std::string& filename);
+
+  // This type is neither copyable nor movable.
+  CpModelColumnarFile(const CpModelColumnarFile&) = delete;
+  CpModelColumnarFile& operator=(const CpModelColumnarFile&) = delete;
+  ~CpModelColumnarFile();
+
+  const CpModelColumnarView& view() const { return *view_; }
+  size_t size_in_bytes() const { return size_in_bytes_; }
+
+ private:
+  CpModelColumnarFile() = default;
+
+  void* mapped_data_ = nullptr;
+  size_t size_in_bytes_ = 0;
+
+  // The content of the file when it is not mapped. We use int64_t to have the
+  // alignment required by the view.
+  std::vector<int64_t> buffer_;
+
+  std::unique_ptr<CpModelColumnarView> view_;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_CP_MODEL_COLUMNAR_H_
@@ -0,0 +1,87 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Converts a CpModelProto to and from the columnar format of
+// cp_model_columnar.h. The direction depends on the file extensions.
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "absl/flags/flag.h"
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "absl/log/check.h"
+#include "absl/log/initialize.h"
+#include "absl/log/log.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/match.h"
+#include "ortools/base/helpers.h"
+#include "ortools/base/options.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_columnar.h"
+#include "ortools/util/file_util.h"
+
+ABSL_FLAG(std::string, input, "",
+          "Required: the model to convert. A .cpcol file is converted to a "
+          "CpModelProto, any other file is read as a CpModelProto (binary or "
+          "text) and converted to the columnar format.");
+
+ABSL_FLAG(std::string, output, "",
+          "Required: where to write the converted model. A CpModelProto uses "
+          "the binary format except if the file extension is '.txt'.");
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+int Run() {
+  const std::string input = absl::GetFlag(FLAGS_input);
+  const std::string output = absl::GetFlag(FLAGS_output);
+  if (input.empty() || output.empty()) {
+    LOG(FATAL) << "Please supply the files with --input= and --output=";
+  }
+
+  if (absl::EndsWith(input, ".cpcol")) {
+    absl::StatusOr<std::unique_ptr<CpModelColumnarFile>> file =
+        CpModelColumnarFile::Open(input);
+    CHECK_OK(file.status());
+    CpModelProto model_proto;
+    (*file)->view().FillCpModelProto(&model_proto);
+    if (absl::EndsWith(output, "txt")) {
+      CHECK_OK(file::SetTextProto(output, model_proto, file::Defaults()));
+    } else {
+      CHECK_OK(file::SetBinaryProto(output, model_proto, file::Defaults()));
+    }
+  } else {
+    CpModelProto model_proto;
+    CHECK_OK(ReadFileToProto(input, &model_proto));
+    CHECK_OK(WriteColumnarModelToFile(model_proto, output));
+  }
+  return EXIT_SUCCESS;
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
+
+static const char kUsage[] =
+    "Usage: see flags.\n"
+    "This program converts a CpModelProto to and from the columnar format.";
+
+int main(int argc, char** argv) {
+  absl::InitializeLog();
+  absl::SetProgramUsageMessage(kUsage);
+  absl::ParseCommandLine(argc, argv);
+  return operations_research::sat::Run();
+}
@@ -0,0 +1,199 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/cp_model_columnar.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "ortools/base/gmock.h"
+#include "ortools/base/parse_test_proto.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+using ::google::protobuf::contrib::parse_proto::ParseTestProto;
+using ::testing::ElementsAre;
+using ::testing::EqualsProto;
+
+const char kModel[] = R"pb(
+  name: "test"
+  variables { domain: [ 0, 10 ] }
+  variables { domain: [ 0, 2, 5, 10 ] }
+  variables { domain: [ 0, 1 ] }
+  constraints {
+    enforcement_literal: 2
+    linear {
+      vars: [ 0, 1 ]
+      coeffs: [ 1, -2 ]
+      domain: [ 0, 3, 5, 8 ]
+    }
+  }
+  constraints { bool_or { literals: [ 2, -3 ] } }
+  constraints {
+    interval {
+      start { vars: 0 coeffs: 1 }
+      end { vars: 0 coeffs: 1 offset: 2 }
+      size { offset: 2 }
+    }
+  }
+  constraints {
+    name: "named"
+    linear {
+      vars: [ 0 ]
+      coeffs: [ 1 ]
+      domain: [ 1, 10 ]
+    }
+  }
+  constraints {
+    enforcement_literal: -3
+    interval {
+      start { vars: 1 coeffs: 1 }
+      end { vars: [ 0, 1 ] coeffs: [ 1, 1 ] }
+      size { vars: 0 coeffs: 1 }
+    }
+  }
+  constraints { no_overlap { intervals: [ 2, 4 ] } }
+  constraints {
+    linear {
+      vars: [ 0, 1, 2 ]
+      coeffs: [ 1, 1, 1 ]
+      domain: [ 0, 20 ]
+    }
+  }
+  objective {
+    vars: [ 0, 1 ]
+    coeffs: [ 1, 2 ]
+  }
+  solution_hint {
+    vars: [ 0 ]
+    values: [ 3 ]
+  }
+)pb";
+
+TEST(CpModelColumnarTest, RoundTrip) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  std::string data;
+  ASSERT_TRUE(WriteColumnarModel(model_proto, &data).ok());
+  const absl::StatusOr<CpModelColumnarView> view =
+      CpModelColumnarView::Create(data);
+  ASSERT_TRUE(view.ok());
+
+  // The bool_or, the named linear and the no_overlap are not in the columns.
+  EXPECT_EQ(view->remainder().constraints_size(), 3);
+  EXPECT_TRUE(view->remainder().variables().empty());
+
+  CpModelProto loaded;
+  view->FillCpModelProto(&loaded);
+  EXPECT_THAT(loaded, EqualsProto(model_proto));
+}
+
+TEST(CpModelColumnarTest, RoundTripWithVariableNames) {
+  CpModelProto model_proto = ParseTestProto(kModel);
+  model_proto.mutable_variables(1)->set_name("y");
+  std::string data;
+  ASSERT_TRUE(WriteColumnarModel(model_proto, &data).ok());
+  const absl::StatusOr<CpModelColumnarView> view =
+      CpModelColumnarView::Create(data);
+  ASSERT_TRUE(view.ok());
+  CpModelProto loaded;
+  view->FillCpModelProto(&loaded);
+  EXPECT_THAT(loaded, EqualsProto(model_proto));
+}
+
+TEST(CpModelColumnarTest, EmptyModel) {
+  std::string data;
+  ASSERT_TRUE(WriteColumnarModel(CpModelProto(), &data).ok());
+  const absl::StatusOr<CpModelColumnarView> view =
+      CpModelColumnarView::Create(data);
+  ASSERT_TRUE(view.ok());
+  EXPECT_EQ(view->num_variables(), 0);
+  EXPECT_EQ(view->num_constraints(), 0);
+  CpModelProto loaded;
+  view->FillCpModelProto(&loaded);
+  EXPECT_THAT(loaded, EqualsProto(CpModelProto()));
+}
+
+TEST(CpModelColumnarTest, LazyAccess) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  std::string data;
+  ASSERT_TRUE(WriteColumnarModel(model_proto, &data).ok());
+  const absl::StatusOr<CpModelColumnarView> view =
+      CpModelColumnarView::Create(data);
+  ASSERT_TRUE(view.ok());
+
+  EXPECT_EQ(view->num_variables(), 3);
+  EXPECT_EQ(view->num_constraints(), 7);
+  EXPECT_THAT(view->VariableDomainValues(1), ElementsAre(0, 2, 5, 10));
+  EXPECT_EQ(view->VariableDomain(1), Domain::FromFlatIntervals({0, 2, 5, 10}));
+  for (int c = 0; c < model_proto.constraints_size(); ++c) {
+    ConstraintProto ct;
+    ct.set_name("to be cleared");
+    view->FillConstraint(c, &ct);
+    EXPECT_THAT(ct, EqualsProto(model_proto.constraints(c)));
+  }
+}
+
+TEST(CpModelColumnarTest, InvalidData) {
+  EXPECT_FALSE(CpModelColumnarView::Create("").ok());
+  EXPECT_FALSE(CpModelColumnarView::Create(std::string(200, 'x')).ok());
+
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  std::string data;
+  ASSERT_TRUE(WriteColumnarModel(model_proto, &data).ok());
+  std::string truncated = data.substr(0, data.size() - 8);
+  EXPECT_FALSE(CpModelColumnarView::Create(truncated).ok());
+
+  // Make the end of the terms of the first linear point past the end of the
+  // terms. The term offsets are after the variable domain starts (4 values),
+  // the variable domain values (8 values), the constraint sources (7 values),
+  // the linear enforcement starts (3 values) and the single linear enforcement
+  // literal, padded to 8 bytes.
+  std::string corrupted = data;
+  const int header_size = 16 + 17 * 8;
+  const int linear_term_starts_offset =
+      header_size + (4 + 8 + 7 + 3 + 1) * 8;
+  const int64_t too_large = 1000;
+  memcpy(corrupted.data() + linear_term_starts_offset + 8, &too_large,
+         sizeof(too_large));
+  EXPECT_FALSE(CpModelColumnarView::Create(corrupted).ok());
+}
+
+TEST(CpModelColumnarTest, WriteAndOpenFile) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  const std::string filename =
+      ::testing::TempDir() + "/cp_model_columnar_test.cpcol";
+  ASSERT_TRUE(WriteColumnarModelToFile(model_proto, filename).ok());
+
+  absl::StatusOr<std::unique_ptr<CpModelColumnarFile>> file =
+      CpModelColumnarFile::Open(filename);
+  ASSERT_TRUE(file.ok());
+  CpModelProto loaded;
+  (*file)->view().FillCpModelProto(&loaded);
+  EXPECT_THAT(loaded, EqualsProto(model_proto));
+
+  EXPECT_FALSE(
+      CpModelColumnarFile::Open(::testing::TempDir() + "/does_not_exist.cpcol")
+          .ok());
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
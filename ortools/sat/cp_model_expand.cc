@@ -1947,6 +1947,19 @@ void ExpandPositiveTable(ConstraintProto* ct, PresolveContext* context) {
     return;
   }
 
+  // Large tables are kept and propagated by a CompactTablePropagator. We
+  // only keep the valid tuples.
+  const int min_num_tuples = context->params().compact_table_min_num_tuples();
+  if (min_num_tuples > 0 && tuples.size() >= min_num_tuples &&
+      ct->enforcement_literal().empty()) {
+    ct->mutable_table()->clear_values();
+    for (const std::vector<int64_t>& tuple : tuples) {
+      for (const int64_t value : tuple) ct->mutable_table()->add_values(value);
+    }
+    context->UpdateRuleStats("table: kept for the compact table propagator");
+    return;
+  }
+
   bool last_column_is_cost = false;
   if (context->params().detect_table_with_cost() &&
       ct->enforcement_literal().empty()) {
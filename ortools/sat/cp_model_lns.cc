@@ -218,170 +218,204 @@ void NeighborhoodGeneratorHelper::InitializeHelperData() {
 
 // Recompute all the data when new variables have been fixed. Note that this
 // shouldn't be called if there is no change as it is in O(problem size).
+//
+// The new data is computed in local variables while only holding the domain
+// lock, and then swapped with the class members under the graph lock. This
+// way the generators reading the graph concurrently are only blocked during
+// the swaps and not during the full computation. This is only called from
+// the constructor and from Synchronize(), so there is a single writer.
 void NeighborhoodGeneratorHelper::RecomputeHelperData() {
-  absl::MutexLock graph_lock(&graph_mutex_);
-  absl::ReaderMutexLock domain_lock(&domain_mutex_);
-
-  // Do basic presolving to have a more precise graph.
-  // Here we just remove trivially true constraints.
-  //
-  // Note(user): We do that each time a new variable is fixed. It might be too
-  // much, but on the miplib and in 1200s, we do that only about 1k time on the
-  // worst case problem.
-  //
-  // TODO(user): Change API to avoid a few copy?
-  // TODO(user): We could keep the context in the class.
-  // TODO(user): We can also start from the previous simplified model instead.
+  std::vector<char> new_arena_storage;
+  std::unique_ptr<google::protobuf::Arena> new_arena;
+  CpModelProto* new_simplified_model_proto = nullptr;
+  CompactVectorVector<int, int> new_constraint_to_var;
+  CompactVectorVector<int, int> new_var_to_constraint;
+  std::vector<bool> new_active_variables_set;
+  std::vector<int> new_active_variables;
+  std::vector<int> new_active_objective_variables;
+  std::vector<std::vector<int>> new_components;
+  std::vector<int> new_var_to_component_index;
   {
-    Model local_model;
-    CpModelProto mapping_proto;
-    // We want to replace the simplified_model_proto_ by a new one. Since
-    // deleting an object in the arena doesn't free the memory, we also delete
-    // and recreate the arena, but reusing the same storage.
-    int64_t new_size = local_arena_->SpaceUsed();
-    new_size += new_size / 2;
-    simplified_model_proto_->Clear();
-    local_arena_.reset();
-    local_arena_storage_.resize(new_size);
-    local_arena_ = std::make_unique<google::protobuf::Arena>(
-        local_arena_storage_.data(), local_arena_storage_.size());
-    simplified_model_proto_ =
-        google::protobuf::Arena::Create<CpModelProto>(local_arena_.get());
-    *simplified_model_proto_->mutable_variables() =
-        model_proto_with_only_variables_.variables();
-    PresolveContext context(&local_model, simplified_model_proto_,
-                            &mapping_proto);
-    ModelCopy copier(&context);
-
-    // TODO(user): Not sure what to do if the model is UNSAT.
-    // This  shouldn't matter as it should be dealt with elsewhere.
-    copier.ImportAndSimplifyConstraints(model_proto_, {});
-  }
-
-  // Compute the constraint <-> variable graph.
-  //
-  // TODO(user): Remove duplicate constraints?
-  const auto& constraints = simplified_model_proto_->constraints();
-  constraint_to_var_.clear();
-  constraint_to_var_.reserve(constraints.size());
-  for (int ct_index = 0; ct_index < constraints.size(); ++ct_index) {
-    // We remove the interval constraints since we should have an equivalent
-    // linear constraint somewhere else. This is not the case if we have a fixed
-    // size optional interval variable. But it should not matter as the
-    // intervals are replaced by their underlying variables in the scheduling
-    // constraints.
-    if (constraints[ct_index].constraint_case() == ConstraintProto::kInterval) {
-      continue;
-    }
+    absl::ReaderMutexLock domain_lock(&domain_mutex_);
 
-    tmp_row_.clear();
-    for (const int var : UsedVariables(constraints[ct_index])) {
-      if (IsConstant(var)) continue;
-      tmp_row_.push_back(var);
-    }
+    // Do basic presolving to have a more precise graph.
+    // Here we just remove trivially true constraints.
+    //
+    // Note(user): We do that each time a new variable is fixed. It might be
+    // too much, but on the miplib and in 1200s, we do that only about 1k time
+    // on the worst case problem.
+    //
+    // TODO(user): Change API to avoid a few copy?
+    // TODO(user): We could keep the context in the class.
+    // TODO(user): We can also start from the previous simplified model
+    // instead.
+    {
+      Model local_model;
+      CpModelProto mapping_proto;
+      // We create a new arena for the new simplified model, sized from the
+      // previous one. The old arena and its storage are released after the
+      // swap below.
+      int64_t new_size = local_arena_->SpaceUsed();
+      new_size += new_size / 2;
+      new_arena_storage.resize(new_size);
+      new_arena = std::make_unique<google::protobuf::Arena>(
+          new_arena_storage.data(), new_arena_storage.size());
+      new_simplified_model_proto =
+          google::protobuf::Arena::Create<CpModelProto>(new_arena.get());
+      *new_simplified_model_proto->mutable_variables() =
+          model_proto_with_only_variables_.variables();
+      PresolveContext context(&local_model, new_simplified_model_proto,
+                              &mapping_proto);
+      ModelCopy copier(&context);
+
+      // TODO(user): Not sure what to do if the model is UNSAT.
+      // This  shouldn't matter as it should be dealt with elsewhere.
+      copier.ImportAndSimplifyConstraints(model_proto_, {});
+    }
+
+    // Compute the constraint <-> variable graph.
+    //
+    // TODO(user): Remove duplicate constraints?
+    const auto& constraints = new_simplified_model_proto->constraints();
+    new_constraint_to_var.reserve(constraints.size());
+    for (int ct_index = 0; ct_index < constraints.size(); ++ct_index) {
+      // We remove the interval constraints since we should have an equivalent
+      // linear constraint somewhere else. This is not the case if we have a
+      // fixed size optional interval variable. But it should not matter as the
+      // intervals are replaced by their underlying variables in the scheduling
+      // constraints.
+      if (constraints[ct_index].constraint_case() ==
+          ConstraintProto::kInterval) {
+        continue;
+      }
 
-    // We replace intervals by their underlying integer variables. Note that
-    // this is needed for a correct decomposition into independent part.
-    bool need_sort = false;
-    for (const int interval : UsedIntervals(constraints[ct_index])) {
-      need_sort = true;
-      for (const int var : UsedVariables(constraints[interval])) {
+      tmp_row_.clear();
+      for (const int var : UsedVariables(constraints[ct_index])) {
         if (IsConstant(var)) continue;
         tmp_row_.push_back(var);
       }
-    }
 
-    // We remove constraint of size 0 and 1 since they are not useful for LNS
-    // based on this graph.
-    if (tmp_row_.size() <= 1) {
-      continue;
-    }
+      // We replace intervals by their underlying integer variables. Note that
+      // this is needed for a correct decomposition into independent part.
+      bool need_sort = false;
+      for (const int interval : UsedIntervals(constraints[ct_index])) {
+        need_sort = true;
+        for (const int var : UsedVariables(constraints[interval])) {
+          if (IsConstant(var)) continue;
+          tmp_row_.push_back(var);
+        }
+      }
+
+      // We remove constraint of size 0 and 1 since they are not useful for LNS
+      // based on this graph.
+      if (tmp_row_.size() <= 1) {
+        continue;
+      }
 
-    // Keep this constraint.
-    if (need_sort) {
-      gtl::STLSortAndRemoveDuplicates(&tmp_row_);
+      // Keep this constraint.
+      if (need_sort) {
+        gtl::STLSortAndRemoveDuplicates(&tmp_row_);
+      }
+      new_constraint_to_var.Add(tmp_row_);
     }
-    constraint_to_var_.Add(tmp_row_);
-  }
 
-  // Initialize var to constraints, and make sure it has an entry for all
-  // variables.
-  var_to_constraint_.ResetFromTranspose(
-      constraint_to_var_,
-      /*min_transpose_size=*/model_proto_.variables().size());
+    // Initialize var to constraints, and make sure it has an entry for all
+    // variables.
+    new_var_to_constraint.ResetFromTranspose(
+        new_constraint_to_var,
+        /*min_transpose_size=*/model_proto_.variables().size());
 
-  // We mark as active all non-constant variables.
-  // Non-active variable will never be fixed in standard LNS fragment.
-  active_variables_.clear();
-  const int num_variables = model_proto_.variables_size();
-  active_variables_set_.assign(num_variables, false);
-  for (int i = 0; i < num_variables; ++i) {
-    if (!IsConstant(i)) {
-      active_variables_.push_back(i);
-      active_variables_set_[i] = true;
+    // We mark as active all non-constant variables.
+    // Non-active variable will never be fixed in standard LNS fragment.
+    const int num_variables = model_proto_.variables_size();
+    new_active_variables_set.assign(num_variables, false);
+    for (int i = 0; i < num_variables; ++i) {
+      if (!IsConstant(i)) {
+        new_active_variables.push_back(i);
+        new_active_variables_set[i] = true;
+      }
     }
-  }
 
-  active_objective_variables_.clear();
-  for (const int var : model_proto_.objective().vars()) {
-    DCHECK(RefIsPositive(var));
-    if (active_variables_set_[var]) {
-      active_objective_variables_.push_back(var);
+    for (const int var : model_proto_.objective().vars()) {
+      DCHECK(RefIsPositive(var));
+      if (new_active_variables_set[var]) {
+        new_active_objective_variables.push_back(var);
+      }
     }
-  }
 
-  // Compute connected components.
-  // Note that fixed variable are just ignored.
-  DenseConnectedComponentsFinder union_find;
-  union_find.SetNumberOfNodes(num_variables);
-  for (int c = 0; c < constraint_to_var_.size(); ++c) {
-    const auto row = constraint_to_var_[c];
-    if (row.size() <= 1) continue;
-    for (int i = 1; i < row.size(); ++i) {
-      union_find.AddEdge(row[0], row[i]);
+    // Compute connected components.
+    // Note that fixed variable are just ignored.
+    DenseConnectedComponentsFinder union_find;
+    union_find.SetNumberOfNodes(num_variables);
+    for (int c = 0; c < new_constraint_to_var.size(); ++c) {
+      const auto row = new_constraint_to_var[c];
+      if (row.size() <= 1) continue;
+      for (int i = 1; i < row.size(); ++i) {
+        union_find.AddEdge(row[0], row[i]);
+      }
+    }
+
+    // If we have a lower bound on the objective, then this "objective
+    // constraint" might link components together.
+    if (ObjectiveDomainIsConstraining()) {
+      const auto& refs = model_proto_.objective().vars();
+      const int num_terms = refs.size();
+      for (int i = 1; i < num_terms; ++i) {
+        union_find.AddEdge(PositiveRef(refs[0]), PositiveRef(refs[i]));
+      }
     }
-  }
 
-  // If we have a lower bound on the objective, then this "objective constraint"
-  // might link components together.
-  if (ObjectiveDomainIsConstraining()) {
-    const auto& refs = model_proto_.objective().vars();
-    const int num_terms = refs.size();
-    for (int i = 1; i < num_terms; ++i) {
-      union_find.AddEdge(PositiveRef(refs[0]), PositiveRef(refs[i]));
+    // Compute all components involving non-fixed variables.
+    //
+    // TODO(user): If a component has no objective, we can fix it to any
+    // feasible solution. This will automatically be done by LNS fragment
+    // covering such component though.
+    new_var_to_component_index.assign(num_variables, -1);
+    for (int var = 0; var < num_variables; ++var) {
+      if (IsConstant(var)) continue;
+      const int root = union_find.FindRoot(var);
+      DCHECK_LT(root, new_var_to_component_index.size());
+      int& index = new_var_to_component_index[root];
+      if (index == -1) {
+        index = new_components.size();
+        new_components.push_back({});
+      }
+      new_var_to_component_index[var] = index;
+      new_components[index].push_back(var);
     }
   }
 
-  // Compute all components involving non-fixed variables.
-  //
-  // TODO(user): If a component has no objective, we can fix it to any feasible
-  // solution. This will automatically be done by LNS fragment covering such
-  // component though.
-  components_.clear();
-  var_to_component_index_.assign(num_variables, -1);
-  for (int var = 0; var < num_variables; ++var) {
-    if (IsConstant(var)) continue;
-    const int root = union_find.FindRoot(var);
-    DCHECK_LT(root, var_to_component_index_.size());
-    int& index = var_to_component_index_[root];
-    if (index == -1) {
-      index = components_.size();
-      components_.push_back({});
-    }
-    var_to_component_index_[var] = index;
-    components_[index].push_back(var);
+  // Sizes used by the log below.
+  const int num_active_variables = new_active_variables.size();
+  const int num_simplified_constraints =
+      new_simplified_model_proto->constraints().size();
+  std::vector<int> component_sizes;
+  for (const std::vector<int>& component : new_components) {
+    component_sizes.push_back(component.size());
   }
 
+  // Publish the new data. After this, the local variables contain the old data
+  // which is destroyed outside of the lock.
+  {
+    absl::MutexLock graph_lock(&graph_mutex_);
+    std::swap(simplified_model_proto_, new_simplified_model_proto);
+    std::swap(constraint_to_var_, new_constraint_to_var);
+    std::swap(var_to_constraint_, new_var_to_constraint);
+    std::swap(active_variables_set_, new_active_variables_set);
+    std::swap(active_variables_, new_active_variables);
+    std::swap(active_objective_variables_, new_active_objective_variables);
+    std::swap(components_, new_components);
+    std::swap(var_to_component_index_, new_var_to_component_index);
+  }
+  std::swap(local_arena_, new_arena);
+  std::swap(local_arena_storage_, new_arena_storage);
+
   // Display information about the reduced problem.
   //
   // TODO(user): Exploit connected component while generating fragments.
   // TODO(user): Do not generate fragment not touching the objective.
   if (!shared_response_->LoggingIsEnabled()) return;
 
-  std::vector<int> component_sizes;
-  for (const std::vector<int>& component : components_) {
-    component_sizes.push_back(component.size());
-  }
   std::sort(component_sizes.begin(), component_sizes.end(),
             std::greater<int>());
   std::string compo_message;
@@ -400,9 +434,9 @@ void NeighborhoodGeneratorHelper::RecomputeHelperData() {
   // nothing else is done for a while, we will never see the "latest" size
   // in the log until it is reduced again.
   shared_response_->LogMessageWithThrottling(
-      "Model", absl::StrCat("var:", active_variables_.size(), "/",
-                            num_variables, " constraints:",
-                            simplified_model_proto_->constraints().size(), "/",
+      "Model", absl::StrCat("var:", num_active_variables, "/",
+                            model_proto_.variables_size(), " constraints:",
+                            num_simplified_constraints, "/",
                             model_proto_.constraints().size(), compo_message));
 }
 
@@ -70,6 +70,9 @@ struct Neighborhood {
   // The delta will contains all variables from the initial model, potentially
   // with updated domains.
   // It can contains new variables and new constraints, and solution hinting.
+  //
+  // The LNS fragment is allocated on the same arena, so the variables and the
+  // hint can be moved out of the delta without any copy.
   std::unique_ptr<google::protobuf::Arena> arena;
   CpModelProto& delta;
 
@@ -301,8 +304,9 @@ class NeighborhoodGeneratorHelper : public SubSolver {
   void InitializeHelperData();
 
   // Recompute most of the class member. This needs to be called when the
-  // domains of the variables are updated.
-  void RecomputeHelperData();
+  // domains of the variables are updated. The graph_mutex_ is only held while
+  // the new data replaces the old one, not during the computation.
+  void RecomputeHelperData() ABSL_LOCKS_EXCLUDED(graph_mutex_, domain_mutex_);
 
   // Indicates if a variable is fixed in the model.
   bool IsConstant(int var) const ABSL_SHARED_LOCKS_REQUIRED(domain_mutex_);
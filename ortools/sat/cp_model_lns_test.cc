@@ -24,6 +24,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
 #include "absl/types/span.h"
+#include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
 #include "ortools/base/gmock.h"
 #include "ortools/base/logging.h"
@@ -831,6 +832,57 @@ TEST(NeighborhoodGeneratorHelperTest, GetSchedulingPrecedences) {
   EXPECT_EQ(precedences, expected_precedences);
 }
 
+// Shared by all the threads of BM_ConcurrentGraphNeighborhoods.
+struct ConcurrentNeighborhoodsFixture {
+  static constexpr int kNumVariables = 10000;
+
+  ConcurrentNeighborhoodsFixture()
+      : proto(Random3SatProblem(kNumVariables,
+                                /*proportion_of_constraints=*/3.0)),
+        shared_bounds(proto),
+        time_limit(&model),
+        helper(&proto, &params, model.GetOrCreate<SharedResponseManager>(),
+               &time_limit, &shared_bounds) {
+    solution.mutable_solution()->Resize(kNumVariables, 0);
+  }
+
+  const CpModelProto proto;
+  SatParameters params;
+  Model model;
+  SharedBoundsManager shared_bounds;
+  ModelSharedTimeLimit time_limit;
+  NeighborhoodGeneratorHelper helper;
+  CpSolverResponse solution;
+};
+
+// Measures the contention on the graph of the helper when many generators run
+// at the same time. The first thread fixes one more variable per iteration and
+// synchronizes the helper, which recomputes the graph, while the other threads
+// generate neighborhoods by exploring it.
+static void BM_ConcurrentGraphNeighborhoods(benchmark::State& state) {
+  static auto* const fixture = new ConcurrentNeighborhoodsFixture();
+  VariableGraphNeighborhoodGenerator generator(&fixture->helper, "graph");
+  random_engine_t random(state.thread_index());
+  NeighborhoodGenerator::SolveData data;
+  data.difficulty = 0.1;
+  int next_var = 0;
+  for (auto _ : state) {
+    if (state.thread_index() == 0) {
+      fixture->shared_bounds.ReportPotentialNewBounds("benchmark", {next_var},
+                                                      {0}, {0});
+      fixture->shared_bounds.Synchronize();
+      fixture->helper.Synchronize();
+      next_var = (next_var + 1) % ConcurrentNeighborhoodsFixture::kNumVariables;
+    } else {
+      const Neighborhood neighborhood =
+          generator.Generate(fixture->solution, data, random);
+      benchmark::DoNotOptimize(neighborhood.is_generated);
+    }
+  }
+}
+
+BENCHMARK(BM_ConcurrentGraphNeighborhoods)->Threads(32);
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
@@ -59,6 +59,7 @@
 #include "ortools/sat/sat_parameters.pb.h"
 #include "ortools/sat/sat_solver.h"
 #include "ortools/sat/symmetry.h"
+#include "ortools/sat/table.h"
 #include "ortools/sat/timetable.h"
 #include "ortools/util/logging.h"
 #include "ortools/util/sorted_interval_list.h"
@@ -1640,6 +1641,87 @@ void LoadRoutesConstraint(const ConstraintProto& ct, Model* m) {
                            /*multiple_subcircuit_through_zero=*/true);
 }
 
+void LoadTableConstraint(const ConstraintProto& ct, Model* m) {
+  const TableConstraintProto& table = ct.table();
+  const int num_exprs = table.exprs_size();
+  if (num_exprs == 0) return;
+  auto* mapping = m->GetOrCreate<CpModelMapping>();
+  auto* integer_trail = m->GetOrCreate<IntegerTrail>();
+  auto* encoder = m->GetOrCreate<IntegerEncoder>();
+  auto* sat_solver = m->GetOrCreate<SatSolver>();
+
+  // The fixed expressions are not part of the propagated table, the other ones
+  // are converted to a positive variable with a coefficient.
+  const std::vector<AffineExpression> exprs = mapping->Affines(table.exprs());
+  std::vector<int> columns;
+  std::vector<IntegerVariable> column_vars;
+  std::vector<IntegerValue> column_coeffs;
+  for (int e = 0; e < num_exprs; ++e) {
+    if (exprs[e].IsConstant()) continue;
+    columns.push_back(e);
+    const bool is_positive = VariableIsPositive(exprs[e].var);
+    column_vars.push_back(PositiveVariable(exprs[e].var));
+    column_coeffs.push_back(is_positive ? exprs[e].coeff : -exprs[e].coeff);
+  }
+
+  // Convert each tuple to the values of the column variables, and skip the
+  // ones that cannot be satisfied.
+  const int num_tuples = table.values_size() / num_exprs;
+  std::vector<std::vector<IntegerValue>> tuples;
+  for (int t = 0; t < num_tuples; ++t) {
+    std::vector<IntegerValue> tuple;
+    bool keep = true;
+    for (int e = 0; e < num_exprs && keep; ++e) {
+      const IntegerValue value(table.values(t * num_exprs + e));
+      if (exprs[e].IsConstant()) {
+        keep = value == exprs[e].constant;
+        continue;
+      }
+      const int i = tuple.size();
+      const IntegerValue diff = value - exprs[e].constant;
+      if (diff % column_coeffs[i] != 0) {
+        keep = false;
+        continue;
+      }
+      const IntegerValue var_value = diff / column_coeffs[i];
+      keep = integer_trail->InitialVariableDomain(column_vars[i])
+                 .Contains(var_value.value());
+      tuple.push_back(var_value);
+    }
+    if (keep) tuples.push_back(std::move(tuple));
+  }
+  if (tuples.empty()) {
+    sat_solver->NotifyThatModelIsUnsat();
+    return;
+  }
+  if (columns.empty()) return;
+
+  // The propagator needs the full encoding of the variables restricted to the
+  // values of the table.
+  for (int i = 0; i < columns.size(); ++i) {
+    std::vector<int64_t> values;
+    for (const std::vector<IntegerValue>& tuple : tuples) {
+      values.push_back(tuple[i].value());
+    }
+    if (!integer_trail->UpdateInitialDomain(column_vars[i],
+                                            Domain::FromValues(values))) {
+      sat_solver->NotifyThatModelIsUnsat();
+      return;
+    }
+    encoder->FullyEncodeVariable(column_vars[i]);
+  }
+
+  std::vector<std::vector<Literal>> literal_tuples(tuples.size());
+  for (int t = 0; t < tuples.size(); ++t) {
+    for (int i = 0; i < columns.size(); ++i) {
+      literal_tuples[t].push_back(
+          encoder->GetOrCreateLiteralAssociatedToEquality(column_vars[i],
+                                                          tuples[t][i]));
+    }
+  }
+  m->Add(CompactTableConstraint(literal_tuples));
+}
+
 bool LoadConstraint(const ConstraintProto& ct, Model* m) {
   switch (ct.constraint_case()) {
     case ConstraintProto::ConstraintCase::CONSTRAINT_NOT_SET:
@@ -1698,6 +1780,12 @@ bool LoadConstraint(const ConstraintProto& ct, Model* m) {
     case ConstraintProto::ConstraintProto::kRoutes:
       LoadRoutesConstraint(ct, m);
       return true;
+    case ConstraintProto::ConstraintProto::kTable:
+      // Only the large positive tables are not expanded, see the
+      // compact_table_min_num_tuples parameter.
+      if (ct.table().negated() || HasEnforcementLiteral(ct)) return false;
+      LoadTableConstraint(ct, m);
+      return true;
     default:
       return false;
   }
@@ -54,6 +54,7 @@
 #include "ortools/base/protobuf_util.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/base/strong_vector.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/base/timer.h"
 #include "ortools/graph/strongly_connected_components.h"
 #include "ortools/graph/topologicalsorter.h"
@@ -7883,8 +7884,32 @@ void CpModelPresolver::Probe() {
     }
   });
 
-  prober->ProbeBooleanVariables(
-      context_->params().probing_deterministic_time_limit());
+  const int num_workers = context_->params().presolve_num_threads();
+  if (num_workers > 1) {
+    // The copies are loaded from the same proto and parameters as the model
+    // above, so they have the same variables. This runs in the probing
+    // threads, so the copies are loaded without our context, which is not
+    // thread-safe. An infeasible copy is reported by the return value, and
+    // then notified to the context below.
+    const CpModelProto& working_model = *context_->working_model;
+    const SatParameters& copy_params = *model.GetOrCreate<SatParameters>();
+    const auto load_copy = [&working_model, &copy_params](int worker,
+                                                          Model* copy) {
+      SatParameters params = copy_params;
+      params.set_random_seed(CombineSeed(params.random_seed(), worker));
+      *copy->GetOrCreate<SatParameters>() = params;
+      copy->GetOrCreate<ModelRandomGenerator>();
+      return LoadModelForPresolve(working_model, std::move(params),
+                                  /*context=*/nullptr, copy,
+                                  "parallel probing");
+    };
+    prober->ProbeBooleanVariablesInParallel(
+        context_->params().probing_deterministic_time_limit(), num_workers,
+        load_copy);
+  } else {
+    prober->ProbeBooleanVariables(
+        context_->params().probing_deterministic_time_limit());
+  }
 
   probing_timer->AddCounter("probed", prober->num_decisions());
   probing_timer->AddToWork(
@@ -10029,7 +10054,9 @@ void CpModelPresolver::DetectDuplicateConstraints() {
   // TODO(user): We might want to do that earlier so that our count of variable
   // usage is not biased by duplicate constraints.
   const std::vector<std::pair<int, int>> duplicates =
-      FindDuplicateConstraints(*context_->working_model);
+      FindDuplicateConstraints(*context_->working_model,
+                               /*ignore_enforcement=*/false,
+                               context_->params().presolve_num_threads());
   timer.AddCounter("duplicates", duplicates.size());
   for (const auto& [dup, rep] : duplicates) {
     // Note that it is important to look at the type of the representative in
@@ -10143,7 +10170,9 @@ void CpModelPresolver::DetectDuplicateConstraintsWithDifferentEnforcements(
   // cte and expr + Y = other_cte, we can see that X is in affine relation with
   // Y.
   const std::vector<std::pair<int, int>> duplicates_without_enforcement =
-      FindDuplicateConstraints(*context_->working_model, true);
+      FindDuplicateConstraints(*context_->working_model,
+                               /*ignore_enforcement=*/true,
+                               context_->params().presolve_num_threads());
   timer.AddCounter("without_enforcements",
                    duplicates_without_enforcement.size());
   for (const auto& [dup, rep] : duplicates_without_enforcement) {
@@ -14043,6 +14072,35 @@ void ApplyVariableMapping(PresolveContext* context, absl::Span<int> mapping,
                                      new_size);
   }
 
+  // Remap the symmetry orbits found during presolve.
+  if (!context->symmetry_orbits.empty()) {
+    const std::vector<int>& orbits = context->symmetry_orbits;
+    int num_new_variables = 0;
+    for (const int image : mapping) {
+      num_new_variables = std::max(num_new_variables, image + 1);
+    }
+    // The orbit ids are compacted to [0, num_orbits) so that they never
+    // collide with the ids given to the variables that are not in any orbit.
+    // The variables not coming from the old model share the last orbit.
+    absl::flat_hash_map<int, int> new_orbit_ids;
+    std::vector<int> new_orbits(num_new_variables, -2);
+    for (int var = 0; var < orbits.size(); ++var) {
+      if (mapping[var] < 0) continue;
+      if (orbits[var] < 0) {
+        new_orbits[mapping[var]] = -1;
+        continue;
+      }
+      const auto [it, inserted] =
+          new_orbit_ids.insert({orbits[var], new_orbit_ids.size()});
+      new_orbits[mapping[var]] = it->second;
+    }
+    const int extra_orbit = new_orbit_ids.size();
+    for (int& orbit : new_orbits) {
+      if (orbit == -2) orbit = extra_orbit;
+    }
+    context->symmetry_orbits = std::move(new_orbits);
+  }
+
   // Remap the solution hint.
   if (proto->has_solution_hint()) {
     auto* mutable_hint = proto->mutable_solution_hint();
@@ -14305,16 +14363,56 @@ struct ConstraintEqForDuplicateDetection {
 }  // namespace
 
 std::vector<std::pair<int, int>> FindDuplicateConstraints(
-    const CpModelProto& model_proto, bool ignore_enforcement) {
+    const CpModelProto& model_proto, bool ignore_enforcement, int num_threads) {
   std::vector<std::pair<int, int>> result;
 
+  // Computing the hashes is the expensive part, and it is independent for each
+  // constraint, so we do it in parallel on large models. The map below only
+  // looks them up, and is filled sequentially in the constraint order, so the
+  // result does not depend on the number of threads.
+  const int num_constraints = model_proto.constraints().size();
+  const ConstraintHashForDuplicateDetection hasher(&model_proto,
+                                                   ignore_enforcement);
+  const auto is_skipped = [&model_proto, ignore_enforcement](int c) {
+    const auto type = model_proto.constraints(c).constraint_case();
+    if (type == ConstraintProto::CONSTRAINT_NOT_SET) return true;
+
+    // Nothing we will presolve in this case.
+    return ignore_enforcement && type == ConstraintProto::kBoolAnd;
+  };
+  std::vector<size_t> hashes(num_constraints, 0);
+  const auto hash_range = [&hashes, &hasher, &is_skipped](int begin, int end) {
+    for (int c = begin; c < end; ++c) {
+      if (!is_skipped(c)) hashes[c] = hasher(c);
+    }
+  };
+  constexpr int kMinConstraintsPerThread = 10000;
+  num_threads =
+      std::max(1, std::min(num_threads,
+                           num_constraints / kMinConstraintsPerThread));
+  if (num_threads == 1) {
+    hash_range(0, num_constraints);
+  } else {
+    ThreadPool pool(num_threads);
+    pool.StartWorkers();
+    for (int t = 0; t < num_threads; ++t) {
+      const int begin = static_cast<int64_t>(num_constraints) * t / num_threads;
+      const int end =
+          static_cast<int64_t>(num_constraints) * (t + 1) / num_threads;
+      pool.Schedule([begin, end, &hash_range]() { hash_range(begin, end); });
+    }
+  }
+  const size_t objective_hash = hasher(kObjectiveConstraint);
+  auto precomputed_hash = [&hashes, objective_hash](int c) {
+    return c == kObjectiveConstraint ? objective_hash : hashes[c];
+  };
+
   // We use a map hash that uses the underlying constraint to compute the hash
   // and the equality for the indices.
-  absl::flat_hash_map<int, int, ConstraintHashForDuplicateDetection,
+  absl::flat_hash_map<int, int, decltype(precomputed_hash),
                       ConstraintEqForDuplicateDetection>
       equiv_constraints(
-          model_proto.constraints_size(),
-          ConstraintHashForDuplicateDetection{&model_proto, ignore_enforcement},
+          model_proto.constraints_size(), precomputed_hash,
           ConstraintEqForDuplicateDetection{&model_proto, ignore_enforcement});
 
   // Create a special representative for the linear objective.
@@ -14322,14 +14420,8 @@ std::vector<std::pair<int, int>> FindDuplicateConstraints(
     equiv_constraints[kObjectiveConstraint] = kObjectiveConstraint;
   }
 
-  const int num_constraints = model_proto.constraints().size();
   for (int c = 0; c < num_constraints; ++c) {
-    const auto type = model_proto.constraints(c).constraint_case();
-    if (type == ConstraintProto::CONSTRAINT_NOT_SET) continue;
-
-    // Nothing we will presolve in this case.
-    if (ignore_enforcement && type == ConstraintProto::kBoolAnd) continue;
-
+    if (is_skipped(c)) continue;
     const auto [it, inserted] = equiv_constraints.insert({c, c});
     if (it->second != c) {
       // Already present!
@@ -434,10 +434,14 @@ CpSolverStatus PresolveCpModel(PresolveContext* context,
 // - enforced constraint duplicate of non-enforced one.
 // - Two enforced constraints with singleton enforcement (vpphard).
 //
+// The constraint hashes are computed with up to num_threads threads on large
+// models. The result does not depend on num_threads.
+//
 // Visible here for testing. This is meant to be called at the end of the
 // presolve where constraints have been canonicalized.
 std::vector<std::pair<int, int>> FindDuplicateConstraints(
-    const CpModelProto& model_proto, bool ignore_enforcement = false);
+    const CpModelProto& model_proto, bool ignore_enforcement = false,
+    int num_threads = 1);
 
 }  // namespace sat
 }  // namespace operations_research
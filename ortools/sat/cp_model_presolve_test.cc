@@ -6302,6 +6302,27 @@ TEST(FindDuplicateConstraintsTest, LinearConstraintParallelToObjective) {
               ::testing::ElementsAre(std::make_pair(0, kObjectiveConstraint)));
 }
 
+TEST(FindDuplicateConstraintsTest, ResultDoesNotDependOnNumThreads) {
+  CpModelProto model;
+  for (int i = 0; i < 10; ++i) {
+    auto* var = model.add_variables();
+    var->add_domain(0);
+    var->add_domain(1);
+  }
+  for (int c = 0; c < 50000; ++c) {
+    BoolArgumentProto* clause = model.add_constraints()->mutable_bool_or();
+    clause->add_literals(c % 7);
+    clause->add_literals(7 + c % 3);
+  }
+
+  const std::vector<std::pair<int, int>> duplicates =
+      FindDuplicateConstraints(model);
+  EXPECT_EQ(duplicates.size(), 50000 - 21);
+  EXPECT_EQ(FindDuplicateConstraints(model, /*ignore_enforcement=*/false,
+                                     /*num_threads=*/4),
+            duplicates);
+}
+
 TEST(DetectDuplicateConstraintsTest, DifferentRedundantEnforcement) {
   const CpModelProto initial_model = ParseTestProto(R"pb(
     variables { domain: [ 0, 1 ] }
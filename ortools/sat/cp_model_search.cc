@@ -512,6 +512,10 @@ absl::flat_hash_map<std::string, SatParameters> GetNamedParameters(
   // via the subsolver_params field.
   base_params.set_log_search_progress(false);
 
+  // The sub-solvers already run in parallel, so their presolve, for instance
+  // the one of each LNS neighborhood, does not use more threads.
+  base_params.set_presolve_num_threads(1);
+
   // The "default" name can be used for the base_params unchanged.
   strategies["default"] = base_params;
 
@@ -78,12 +78,14 @@
 #include "ortools/sat/parameters_validation.h"
 #include "ortools/sat/presolve_context.h"
 #include "ortools/sat/primary_variables.h"
+#include "ortools/sat/remote_sharing.h"
 #include "ortools/sat/routing_cuts.h"
 #include "ortools/sat/sat_base.h"
 #include "ortools/sat/sat_inprocessing.h"
 #include "ortools/sat/sat_parameters.pb.h"
 #include "ortools/sat/sat_solver.h"
 #include "ortools/sat/shaving_solver.h"
+#include "ortools/sat/solution_cache.h"
 #include "ortools/sat/stat_tables.h"
 #include "ortools/sat/subsolver.h"
 #include "ortools/sat/synchronization.h"
@@ -859,7 +861,8 @@ void LaunchSubsolvers(const SatParameters& params, SharedClasses* shared,
     DeterministicLoop(subsolvers, params.num_workers(), batch_size,
                       params.max_num_deterministic_batches());
   } else {
-    NonDeterministicLoop(subsolvers, params.num_workers(), shared->time_limit);
+    NonDeterministicLoop(subsolvers, params.num_workers(), shared->time_limit,
+                         params.pin_workers_to_cpus());
   }
 
   // We need to delete the subsolvers in order to fill the stat tables. Note
@@ -1076,6 +1079,7 @@ class FullProblemSolver : public SubSolver {
     shared_->stat_tables->AddLpStat(name(), &local_model_);
     shared_->stat_tables->AddSearchStat(name(), &local_model_);
     shared_->stat_tables->AddClausesStat(name(), &local_model_);
+    shared_->stat_tables->AddPropagatorStat(&local_model_);
   }
 
   bool IsDone() override {
@@ -1177,6 +1181,10 @@ class FullProblemSolver : public SubSolver {
       const double saved_dtime = time_limit->GetElapsedDeterministicTime();
       SolveLoadedCpModel(shared_->model_proto, &local_model_);
 
+      // Export the binary clauses learned since the last flush.
+      auto* binary_clauses = local_model_.Mutable<BinaryClauseExportBuffer>();
+      if (binary_clauses != nullptr) binary_clauses->Flush();
+
       absl::MutexLock mutex_lock(&mutex_);
       previous_task_is_completed_ = true;
       dtime_since_last_sync_ +=
@@ -1324,7 +1332,8 @@ class LnsSolver : public SubSolver {
         /*num_calls=*/generator_->num_calls(),
         /*num_improving_calls=*/generator_->num_improving_calls(),
         /*difficulty=*/generator_->difficulty(),
-        /*deterministic_limit=*/generator_->deterministic_limit());
+        /*deterministic_limit=*/generator_->deterministic_limit(),
+        /*wall_time=*/shared_->wall_timer->Get() - creation_wall_time_);
   }
 
   bool TaskIsAvailable() override {
@@ -1420,21 +1429,23 @@ class LnsSolver : public SubSolver {
       shared_->time_limit->UpdateLocalLimit(local_time_limit);
 
       // Presolve and solve the LNS fragment.
-      size_t buffer_size;
-      {
-        absl::MutexLock l(&next_arena_size_mutex_);
-        buffer_size = next_arena_size_;
-      }
-      google::protobuf::Arena arena(
-          google::protobuf::ArenaOptions({.start_block_size = buffer_size}));
+      //
+      // The fragment lives on the same arena as the neighborhood delta so that
+      // the variable domains and the hint can be moved from the delta instead
+      // of being copied. On large models this copy was a significant part of
+      // the time needed to create a fragment. The constraints of the base
+      // model are never copied as is, they are simplified on the fly by the
+      // ModelCopy below.
+      google::protobuf::Arena* arena = neighborhood.arena.get();
       CpModelProto& lns_fragment =
-          *google::protobuf::Arena::Create<CpModelProto>(&arena);
+          *google::protobuf::Arena::Create<CpModelProto>(arena);
       CpModelProto& mapping_proto =
-          *google::protobuf::Arena::Create<CpModelProto>(&arena);
+          *google::protobuf::Arena::Create<CpModelProto>(arena);
       auto context = std::make_unique<PresolveContext>(
           &local_model, &lns_fragment, &mapping_proto);
 
-      *lns_fragment.mutable_variables() = neighborhood.delta.variables();
+      lns_fragment.mutable_variables()->Swap(
+          neighborhood.delta.mutable_variables());
       {
         ModelCopy copier(context.get());
 
@@ -1468,8 +1479,8 @@ class LnsSolver : public SubSolver {
 
       // Overwrite solution hinting.
       if (neighborhood.delta.has_solution_hint()) {
-        *lns_fragment.mutable_solution_hint() =
-            neighborhood.delta.solution_hint();
+        lns_fragment.mutable_solution_hint()->Swap(
+            neighborhood.delta.mutable_solution_hint());
       }
       if (generator_->num_consecutive_non_improving_calls() > 10 &&
           absl::Bernoulli(random, 0.5)) {
@@ -1715,10 +1726,6 @@ class LnsSolver : public SubSolver {
             ", #calls:", generator_->num_calls(),
             ", p:", fully_solved_proportion, "]");
       }
-      {
-        absl::MutexLock l(&next_arena_size_mutex_);
-        next_arena_size_ = arena.SpaceUsed();
-      }
     };
   }
 
@@ -1738,15 +1745,7 @@ class LnsSolver : public SubSolver {
   const SatParameters lns_parameters_base_;
   const SatParameters lns_parameters_stalling_;
   SharedClasses* shared_;
-  // This is a optimization to allocate the arena for the LNS fragment already
-  // at roughly the right size. We will update it with the last size of the
-  // latest LNS fragment.
-  absl::Mutex next_arena_size_mutex_;
-  int64_t next_arena_size_ ABSL_GUARDED_BY(next_arena_size_mutex_) =
-      helper_->ModelProto().GetArena() == nullptr
-          ? Neighborhood::kDefaultArenaSizePerVariable
-                * helper_->ModelProto().variables_size()
-          : helper_->ModelProto().GetArena()->SpaceUsed();
+  const double creation_wall_time_ = shared_->wall_timer->Get();
 };
 
 void SolveCpModelParallel(SharedClasses* shared, Model* global_model) {
@@ -1795,6 +1794,15 @@ void SolveCpModelParallel(SharedClasses* shared, Model* global_model) {
         }
       }));
 
+  // If a SharingTransport was registered in the model, exchange the shared
+  // information with the process at the other end right after it is published.
+  if (SharingTransport* transport = global_model->Mutable<SharingTransport>();
+      transport != nullptr) {
+    subsolvers.push_back(std::make_unique<RemoteSharingHelper>(
+        transport, &shared->model_proto, shared->response,
+        shared->bounds.get(), shared->clauses.get()));
+  }
+
   const auto name_to_params = GetNamedParameters(params);
   const SatParameters& lns_params_base = name_to_params.at("lns_base");
   const SatParameters& lns_params_stalling = name_to_params.at("lns_stalling");
@@ -2347,6 +2355,24 @@ void RegisterSearchStatisticCallback(Model* global_model) {
           num_lp_iters += lp->total_num_simplex_iterations();
         }
         response->set_num_lp_iterations(num_lp_iters);
+
+        response->clear_propagator_stats();
+        auto* watcher = local_model->Get<GenericLiteralWatcher>();
+        if (watcher == nullptr) return;
+        for (const PropagatorStats& stats : watcher->GetPropagatorStats()) {
+          PropagatorStatsProto* proto = response->add_propagator_stats();
+          proto->set_name(stats.name);
+          proto->set_num_calls(stats.num_calls);
+          proto->set_num_calls_without_push(stats.num_calls_without_push);
+          proto->set_num_conflicts(stats.num_conflicts);
+          proto->set_num_integer_pushes(stats.num_integer_pushes);
+          proto->set_num_literal_pushes(stats.num_literal_pushes);
+          proto->set_num_reason_elements(stats.num_reason_elements);
+          proto->set_num_conflict_literals(stats.num_conflict_literals);
+          proto->set_num_timed_calls(stats.num_timed_calls);
+          proto->set_timed_seconds(stats.TimedSeconds());
+          proto->set_estimated_seconds(stats.EstimatedSeconds());
+        }
       });
 }
 
@@ -2581,6 +2607,27 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
     context->working_model->clear_solution_hint();
   }
 
+  // Warm-start from the solution of a previous solve of the same model
+  // structure, and save our best solution for the next one.
+  if (!params.solution_cache_directory().empty()) {
+    if (!context->working_model->has_solution_hint() &&
+        LoadCachedSolutionHint(
+            params.solution_cache_directory(), model_proto,
+            context->working_model->mutable_solution_hint())) {
+      SOLVER_LOG(logger, "Using the cached solution of ",
+                 SolutionCacheFile(params.solution_cache_directory(),
+                                   model_proto),
+                 " as a hint.");
+    }
+    shared_response_manager->AddFinalResponsePostprocessor(
+        [&params, &model_proto, logger](CpSolverResponse* response) {
+          if (!SaveSolutionInCache(params.solution_cache_directory(),
+                                   model_proto, *response)) {
+            SOLVER_LOG(logger, "Failed to save the solution in the cache.");
+          }
+        });
+  }
+
   // Checks for hints early in case they are forced to be hard constraints.
   if (params.fix_variables_to_their_hinted_value() &&
       model_proto.has_solution_hint()) {
@@ -2731,6 +2778,8 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
 
   // Delete the context as soon as the presolve is done. Note that only
   // postsolve_mapping and mapping_proto are needed for postsolve.
+  const std::vector<int> presolve_symmetry_orbits =
+      std::move(context->symmetry_orbits);
   context.reset(nullptr);
 
   if (presolve_status != CpSolverStatus::UNKNOWN) {
@@ -2767,7 +2816,7 @@ CpSolverResponse SolveCpModel(const CpModelProto& model_proto, Model* model) {
       TimeLimit time_limit;
       shared_time_limit->UpdateLocalLimit(&time_limit);
       DetectAndAddSymmetryToProto(params, new_cp_model_proto, logger,
-                                  &time_limit);
+                                  &time_limit, presolve_symmetry_orbits);
     }
   }
 
@@ -936,8 +936,14 @@ void RegisterObjectiveBoundsImport(
 void RegisterClausesExport(int id, SharedClausesManager* shared_clauses_manager,
                            Model* model) {
   auto* mapping = model->GetOrCreate<CpModelMapping>();
-  const auto& share_binary_clause = [mapping, id, shared_clauses_manager](
-                                        Literal l1, Literal l2) {
+
+  // New binary clauses are buffered and exported in one batch each time we are
+  // back at level zero, at each glue clause sharing, or when there are many of
+  // them. See BinaryClauseExportBuffer.
+  auto* binary_clauses = model->GetOrCreate<BinaryClauseExportBuffer>();
+  binary_clauses->Register(id, shared_clauses_manager);
+  const auto& share_binary_clause = [mapping, binary_clauses](Literal l1,
+                                                              Literal l2) {
     const int var1 =
         mapping->GetProtoVariableFromBooleanVariable(l1.Variable());
     if (var1 == -1) return;
@@ -946,10 +952,15 @@ void RegisterClausesExport(int id, SharedClausesManager* shared_clauses_manager,
     if (var2 == -1) return;
     const int lit1 = l1.IsPositive() ? var1 : NegatedRef(var1);
     const int lit2 = l2.IsPositive() ? var2 : NegatedRef(var2);
-    shared_clauses_manager->AddBinaryClause(id, lit1, lit2);
+    binary_clauses->Add(lit1, lit2);
   };
   model->GetOrCreate<BinaryImplicationGraph>()->SetAdditionCallback(
       share_binary_clause);
+  model->GetOrCreate<LevelZeroCallbackHelper>()->callbacks.push_back(
+      [binary_clauses]() {
+        binary_clauses->Flush();
+        return true;
+      });
   if (!model->GetOrCreate<SatParameters>()->share_glue_clauses()) {
     return;
   }
@@ -957,7 +968,7 @@ void RegisterClausesExport(int id, SharedClausesManager* shared_clauses_manager,
       model->GetOrCreate<SatParameters>()->share_glue_clauses_dtime();
   auto* clause_stream = model->GetOrCreate<UniqueClauseStream>();
   auto* time_limit = model->GetOrCreate<TimeLimit>();
-  auto share_clause = [mapping, clause_stream, time_limit, id,
+  auto share_clause = [mapping, clause_stream, binary_clauses, time_limit, id,
                        shared_clauses_manager, share_interval,
                        next_batch_dtime = -1.0, clause = std::vector<int>()](
                           int lbd, absl::Span<const Literal> literals) mutable {
@@ -975,6 +986,7 @@ void RegisterClausesExport(int id, SharedClausesManager* shared_clauses_manager,
     const double elapsed_dtime = time_limit->GetElapsedDeterministicTime();
     if (next_batch_dtime < 0) next_batch_dtime = elapsed_dtime + share_interval;
     if (elapsed_dtime >= next_batch_dtime) {
+      binary_clauses->Flush();
       shared_clauses_manager->AddBatch(id, clause_stream->NextBatch());
       next_batch_dtime = elapsed_dtime + share_interval;
     }
@@ -2108,6 +2120,16 @@ SharedClasses::SharedClasses(const CpModelProto* proto, Model* global_model)
         incomplete_solutions.get());
   }
 
+  if (params.share_lp_basis() && params.num_workers() > 1) {
+    lp_bases = std::make_unique<SharedLPBasisRepository>();
+    global_model->Register<SharedLPBasisRepository>(lp_bases.get());
+  }
+
+  if (params.share_lp_cuts() && params.num_workers() > 1) {
+    cuts = std::make_unique<SharedCutPool>();
+    global_model->Register<SharedCutPool>(cuts.get());
+  }
+
   // Set up synchronization mode in parallel.
   const bool always_synchronize =
       !params.interleave_search() || params.num_workers() <= 1;
@@ -2134,6 +2156,12 @@ void SharedClasses::RegisterSharedClassesInLocalModel(Model* local_model) {
     local_model->Register<SharedIncompleteSolutionManager>(
         incomplete_solutions.get());
   }
+  if (lp_bases != nullptr) {
+    local_model->Register<SharedLPBasisRepository>(lp_bases.get());
+  }
+  if (cuts != nullptr) {
+    local_model->Register<SharedCutPool>(cuts.get());
+  }
   if (bounds != nullptr) {
     local_model->Register<SharedBoundsManager>(bounds.get());
   }
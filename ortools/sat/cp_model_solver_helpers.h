@@ -58,6 +58,8 @@ struct SharedClasses {
   // These can be nullptr depending on the options.
   std::unique_ptr<SharedBoundsManager> bounds;
   std::unique_ptr<SharedLPSolutionRepository> lp_solutions;
+  std::unique_ptr<SharedLPBasisRepository> lp_bases;
+  std::unique_ptr<SharedCutPool> cuts;
   std::unique_ptr<SharedIncompleteSolutionManager> incomplete_solutions;
   std::unique_ptr<SharedClausesManager> clauses;
 
@@ -72,6 +74,12 @@ struct SharedClasses {
 // This should only be called once on a given 'Model' class.
 void LoadCpModel(const CpModelProto& model_proto, Model* model);
 
+// Returns the values of the model_proto variables in the current assignment
+// of a model loaded with LoadCpModel(). Non-fixed variables take their lower
+// bound.
+std::vector<int64_t> GetSolutionValues(const CpModelProto& model_proto,
+                                       const Model& model);
+
 // Solves an already loaded cp_model_proto.
 // The final CpSolverResponse must be read from the shared_response_manager.
 //
@@ -127,6 +127,57 @@ TEST(StopAfterFirstSolutionTest, BooleanLinearOptimizationProblem) {
   LOG(INFO) << CpSolverResponseStats(response);
 }
 
+TEST(FeasibilityJumpTest, BatchedLinearMoves) {
+  const CpModelProto model_proto =
+      Random3SatProblem(200, /*proportion_of_constraints=*/2.0);
+  SatParameters params;
+  params.set_use_ls_only(true);
+  params.set_num_workers(2);
+  params.set_cp_model_presolve(false);
+  params.set_feasibility_jump_max_moves_per_scan(8);
+  params.set_max_time_in_seconds(10.0);
+  const CpSolverResponse response = SolveWithParameters(model_proto, params);
+  ASSERT_THAT(response.status(),
+              AnyOf(Eq(CpSolverStatus::OPTIMAL), Eq(CpSolverStatus::FEASIBLE)));
+  EXPECT_TRUE(SolutionIsFeasible(
+      model_proto, std::vector<int64_t>(response.solution().begin(),
+                                        response.solution().end())));
+}
+
+TEST(ShareLpBasisTest, BooleanLinearOptimizationProblem) {
+  const CpModelProto model_proto = RandomLinearProblem(50, 50);
+  SatParameters params;
+  params.set_num_workers(4);
+  params.set_share_lp_basis(true);
+  params.set_linearization_level(2);
+  const CpSolverResponse response = SolveWithParameters(model_proto, params);
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+
+  params.set_num_workers(1);
+  const CpSolverResponse single_thread_response =
+      SolveWithParameters(model_proto, params);
+  EXPECT_EQ(single_thread_response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_EQ(response.objective_value(),
+            single_thread_response.objective_value());
+}
+
+TEST(ShareLpCutsTest, BooleanLinearOptimizationProblem) {
+  const CpModelProto model_proto = RandomLinearProblem(50, 50);
+  SatParameters params;
+  params.set_num_workers(4);
+  params.set_share_lp_cuts(true);
+  params.set_linearization_level(2);
+  const CpSolverResponse response = SolveWithParameters(model_proto, params);
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+
+  params.set_num_workers(1);
+  const CpSolverResponse single_thread_response =
+      SolveWithParameters(model_proto, params);
+  EXPECT_EQ(single_thread_response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_EQ(response.objective_value(),
+            single_thread_response.objective_value());
+}
+
 TEST(RelativeGapLimitTest, BooleanLinearOptimizationProblem) {
   const CpModelProto model_proto = RandomLinearProblem(100, 100);
   LOG(INFO) << CpModelStats(model_proto);
@@ -641,12 +641,42 @@ std::unique_ptr<Graph> GenerateGraphForSymmetryDetection(
 
   return graph;
 }
+
+// Splits the equivalence classes of the variable nodes by previous orbit, see
+// FindCpModelSymmetries(). The variables that were not moved by the previous
+// symmetries get their own class. The search is much faster with many small
+// classes.
+void RefineClassesWithPreviousOrbits(absl::Span<const int> previous_orbits,
+                                     int num_variables,
+                                     std::vector<int>* equivalence_classes) {
+  const int num_restricted =
+      std::min<int>(num_variables, previous_orbits.size());
+  // The variables in no previous orbit get ids above all the orbit ids.
+  int64_t max_orbit = -1;
+  for (const int orbit : previous_orbits) {
+    max_orbit = std::max<int64_t>(max_orbit, orbit);
+  }
+  absl::flat_hash_map<std::pair<int, int64_t>, int> new_classes;
+  for (int node = 0; node < equivalence_classes->size(); ++node) {
+    int64_t orbit = -1;
+    if (node < num_restricted) {
+      orbit = previous_orbits[node] >= 0 ? previous_orbits[node]
+                                         : max_orbit + 1 + node;
+    }
+    const int new_class = new_classes.size();
+    const auto [it, inserted] = new_classes.insert(
+        {{(*equivalence_classes)[node], orbit}, new_class});
+    (*equivalence_classes)[node] = it->second;
+  }
+}
+
 }  // namespace
 
-void FindCpModelSymmetries(
+bool FindCpModelSymmetries(
     const SatParameters& params, const CpModelProto& problem,
     std::vector<std::unique_ptr<SparsePermutation>>* generators,
-    SolverLogger* logger, TimeLimit* solver_time_limit) {
+    SolverLogger* logger, TimeLimit* solver_time_limit,
+    absl::Span<const int> previous_orbits) {
   CHECK(generators != nullptr);
   generators->clear();
 
@@ -655,7 +685,7 @@ void FindCpModelSymmetries(
     SOLVER_LOG(logger,
                "[Symmetry] Problem too large. Skipping. You can use "
                "symmetry_level:3 or more to force it.");
-    return;
+    return false;
   }
 
   typedef GraphSymmetryFinder::Graph Graph;
@@ -663,19 +693,25 @@ void FindCpModelSymmetries(
   std::vector<int> equivalence_classes;
   std::unique_ptr<Graph> graph(GenerateGraphForSymmetryDetection<Graph>(
       problem, &equivalence_classes, logger));
-  if (graph == nullptr) return;
+  if (graph == nullptr) return false;
 
   SOLVER_LOG(logger, "[Symmetry] Graph for symmetry has ",
              FormatCounter(graph->num_nodes()), " nodes and ",
              FormatCounter(graph->num_arcs()), " arcs.");
-  if (graph->num_nodes() == 0) return;
+  if (graph->num_nodes() == 0) return true;
 
   if (params.symmetry_level() < 3 && graph->num_nodes() > 1e6 &&
       graph->num_arcs() > 1e6) {
     SOLVER_LOG(logger,
                "[Symmetry] Graph too large. Skipping. You can use "
                "symmetry_level:3 or more to force it.");
-    return;
+    return false;
+  }
+
+  if (!previous_orbits.empty()) {
+    RefineClassesWithPreviousOrbits(previous_orbits, problem.variables_size(),
+                                    &equivalence_classes);
+    SOLVER_LOG(logger, "[Symmetry] Search restricted to the previous orbits.");
   }
 
   std::unique_ptr<TimeLimit> time_limit = TimeLimit::FromDeterministicTime(
@@ -693,6 +729,7 @@ void FindCpModelSymmetries(
     SOLVER_LOG(logger,
                "[Symmetry] GraphSymmetryFinder error: ", status.message());
   }
+  const bool is_complete = status.ok() && !time_limit->LimitReached();
 
   // Remove from the permutations the part not concerning the variables.
   // Note that some permutations may become empty, which means that we had
@@ -740,6 +777,7 @@ void FindCpModelSymmetries(
                  num_duplicate_constraints, " duplicate constraints !");
     }
   }
+  return is_complete;
 }
 
 namespace {
@@ -769,12 +807,14 @@ void LogOrbitInformation(absl::Span<const int> var_to_orbit_index,
 
 void DetectAndAddSymmetryToProto(const SatParameters& params,
                                  CpModelProto* proto, SolverLogger* logger,
-                                 TimeLimit* time_limit) {
+                                 TimeLimit* time_limit,
+                                 absl::Span<const int> previous_orbits) {
   SymmetryProto* symmetry = proto->mutable_symmetry();
   symmetry->Clear();
 
   std::vector<std::unique_ptr<SparsePermutation>> generators;
-  FindCpModelSymmetries(params, *proto, &generators, logger, time_limit);
+  FindCpModelSymmetries(params, *proto, &generators, logger, time_limit,
+                        previous_orbits);
   if (generators.empty()) {
     proto->clear_symmetry();
     return;
@@ -968,13 +1008,19 @@ bool DetectAndExploitSymmetriesInPresolve(PresolveContext* context) {
   }
 
   std::vector<std::unique_ptr<SparsePermutation>> generators;
-  FindCpModelSymmetries(params, proto, &generators, context->logger(),
-                        context->time_limit());
+  const bool is_complete =
+      FindCpModelSymmetries(params, proto, &generators, context->logger(),
+                            context->time_limit());
 
   // Remove temporary affine relation.
   context->working_model->mutable_constraints()->DeleteSubrange(
       initial_ct_index, num_added);
 
+  // The orbits are only meaningful if we found the full symmetry group.
+  if (is_complete && params.reuse_presolve_symmetry_orbits()) {
+    context->symmetry_orbits = GetOrbits(num_vars, generators);
+  }
+
   if (generators.empty()) return true;
 
   // Collect the at most ones.
@@ -17,6 +17,7 @@
 #include <memory>
 #include <vector>
 
+#include "absl/types/span.h"
 #include "ortools/algorithms/sparse_permutation.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/presolve_context.h"
@@ -39,6 +40,17 @@ namespace sat {
 // enforces params.symmetry_detection_deterministic_time_limit() per call on top
 // of it.
 //
+// If previous_orbits is not empty, only the symmetries that map each variable
+// in its orbit of previous_orbits are found. These are the orbits found on a
+// previous version of the problem, in the format of GetOrbits(): an index of -1
+// means that the variable can only be mapped to itself. This is a lot faster
+// when the problem did not change much, but the symmetries involving the
+// variables not in the same previous orbit are lost. The variables with an
+// index >= previous_orbits.size() can only be mapped to each other.
+//
+// Returns false if the search was incomplete, for instance because the time
+// limit was reached. The returned generators are always valid.
+//
 // TODO(user): On SAT problems it is more powerful to detect permutations also
 // involving the negation of the problem variables. So that we could find a
 // symmetry x <-> not(y) for instance.
@@ -46,15 +58,18 @@ namespace sat {
 // TODO(user): As long as we only exploit symmetry involving only Boolean
 // variables we can make this code more efficient by not detecting symmetries
 // involving integer variable.
-void FindCpModelSymmetries(
+bool FindCpModelSymmetries(
     const SatParameters& params, const CpModelProto& problem,
     std::vector<std::unique_ptr<SparsePermutation>>* generators,
-    SolverLogger* logger, TimeLimit* solver_time_limit);
+    SolverLogger* logger, TimeLimit* solver_time_limit,
+    absl::Span<const int> previous_orbits = {});
 
-// Detects symmetries and fill the symmetry field.
+// Detects symmetries and fill the symmetry field. See FindCpModelSymmetries()
+// for the previous_orbits argument.
 void DetectAndAddSymmetryToProto(const SatParameters& params,
                                  CpModelProto* proto, SolverLogger* logger,
-                                 TimeLimit* solver_time_limit);
+                                 TimeLimit* solver_time_limit,
+                                 absl::Span<const int> previous_orbits = {});
 
 // Basic implementation of some symmetry breaking during presolve.
 //
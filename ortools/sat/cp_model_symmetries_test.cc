@@ -27,6 +27,7 @@
 #include "ortools/sat/model.h"
 #include "ortools/sat/presolve_context.h"
 #include "ortools/sat/sat_parameters.pb.h"
+#include "ortools/sat/symmetry_util.h"
 #include "ortools/util/logging.h"
 #include "ortools/util/time_limit.h"
 
@@ -77,6 +78,50 @@ TEST(FindCpModelSymmetries, FindsSymmetry) {
   EXPECT_EQ(generators[0]->DebugString(), "(1 2)");
 }
 
+TEST(FindCpModelSymmetries, RestrictedToPreviousOrbits) {
+  const CpModelProto model = ParseTestProto(R"pb(
+    variables { domain: [ 0, 1 ] }
+    variables { domain: [ 0, 1 ] }
+    variables { domain: [ 0, 1 ] }
+    variables { domain: [ 0, 1 ] }
+    constraints { at_most_one { literals: [ 0, 1, 2, 3 ] } }
+  )pb");
+
+  std::vector<std::unique_ptr<SparsePermutation>> generators;
+  SolverLogger logger;
+  TimeLimit time_limit;
+  EXPECT_TRUE(
+      FindCpModelSymmetries({}, model, &generators, &logger, &time_limit));
+  std::vector<int> orbits = GetOrbits(4, generators);
+  EXPECT_EQ(std::count(orbits.begin(), orbits.end(), orbits[0]), 4);
+
+  EXPECT_TRUE(FindCpModelSymmetries({}, model, &generators, &logger,
+                                    &time_limit, {0, 0, 1, 1}));
+  orbits = GetOrbits(4, generators);
+  EXPECT_NE(orbits[0], -1);
+  EXPECT_EQ(orbits[0], orbits[1]);
+  EXPECT_NE(orbits[1], orbits[2]);
+  EXPECT_EQ(orbits[2], orbits[3]);
+
+  // Variable 0 was not moved and variable 3 is not in the previous orbits.
+  EXPECT_TRUE(FindCpModelSymmetries({}, model, &generators, &logger,
+                                    &time_limit, {-1, 0, 0}));
+  orbits = GetOrbits(4, generators);
+  EXPECT_EQ(orbits[0], -1);
+  EXPECT_NE(orbits[1], -1);
+  EXPECT_EQ(orbits[1], orbits[2]);
+  EXPECT_EQ(orbits[3], -1);
+
+  // The orbit ids do not need to be dense, variable 0 must stay fixed.
+  EXPECT_TRUE(FindCpModelSymmetries({}, model, &generators, &logger,
+                                    &time_limit, {-1, 4, 4, 4}));
+  orbits = GetOrbits(4, generators);
+  EXPECT_EQ(orbits[0], -1);
+  EXPECT_NE(orbits[1], -1);
+  EXPECT_EQ(orbits[1], orbits[2]);
+  EXPECT_EQ(orbits[2], orbits[3]);
+}
+
 TEST(FindCpModelSymmetries, NoSymmetryIfDifferentVariableBounds) {
   CpModelProto model = ParseTestProto(kBaseModel);
   model.mutable_variables(1)->set_domain(1, 20);
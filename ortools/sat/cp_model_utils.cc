@@ -31,6 +31,7 @@
 #include "google/protobuf/descriptor.h"
 #include "google/protobuf/message.h"
 #include "google/protobuf/text_format.h"
+#include "ortools/base/hash.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/sat_base.h"
@@ -897,6 +898,23 @@ uint64_t FingerprintModel(const CpModelProto& model, uint64_t seed) {
   return fp;
 }
 
+uint64_t FingerprintModelStructure(const CpModelProto& model, uint64_t seed) {
+  uint64_t fp = FingerprintSingleField(model.variables_size(), seed);
+  for (const ConstraintProto& ct : model.constraints()) {
+    fp = FingerprintSingleField(static_cast<int>(ct.constraint_case()), fp);
+    const std::vector<int> variables = UsedVariables(ct);
+    fp = fasthash64(variables.data(), variables.size() * sizeof(int), fp);
+    const std::vector<int> intervals = UsedIntervals(ct);
+    fp = fasthash64(intervals.data(), intervals.size() * sizeof(int), fp);
+  }
+  if (model.has_objective()) {
+    fp = FingerprintRepeatedField(model.objective().vars(), fp);
+  } else if (model.has_floating_point_objective()) {
+    fp = FingerprintRepeatedField(model.floating_point_objective().vars(), fp);
+  }
+  return fp;
+}
+
 #if !defined(__PORTABLE_PLATFORM__)
 namespace {
 
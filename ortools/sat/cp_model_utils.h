@@ -311,6 +311,14 @@ uint64_t FingerprintExpression(const LinearExpressionProto& lin, uint64_t seed);
 uint64_t FingerprintModel(const CpModelProto& model,
                           uint64_t seed = kDefaultFingerprintSeed);
 
+// Returns a fingerprint of the structure of a model: its number of variables,
+// the type of each constraint and the variables and intervals it uses, and the
+// objective variables. Unlike FingerprintModel(), this ignores the domains,
+// coefficients, constants and solution hint, so small edits of a model keep the
+// same fingerprint.
+uint64_t FingerprintModelStructure(const CpModelProto& model,
+                                   uint64_t seed = kDefaultFingerprintSeed);
+
 #if !defined(__PORTABLE_PLATFORM__)
 
 // We register a few custom printers to display variables and linear
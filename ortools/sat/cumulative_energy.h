@@ -15,6 +15,7 @@
 #define OR_TOOLS_SAT_CUMULATIVE_ENERGY_H_
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,7 @@ class CumulativeEnergyConstraint : public PropagatorInterface {
                              SchedulingConstraintHelper* helper,
                              SchedulingDemandHelper* demands, Model* model);
 
+  std::string Name() const final { return "CumulativeEnergyConstraint"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -98,6 +100,7 @@ class CumulativeIsAfterSubsetConstraint : public PropagatorInterface {
                                     SchedulingDemandHelper* demands,
                                     Model* model);
 
+  std::string Name() const final { return "CumulativeIsAfterSubsetConstraint"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -129,6 +132,9 @@ class CumulativeDualFeasibleEnergyConstraint : public PropagatorInterface {
 
   ~CumulativeDualFeasibleEnergyConstraint() override;
 
+  std::string Name() const final {
+    return "CumulativeDualFeasibleEnergyConstraint";
+  }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -49,6 +50,9 @@ class NonOverlappingRectanglesEnergyPropagator : public PropagatorInterface {
 
   ~NonOverlappingRectanglesEnergyPropagator() override;
 
+  std::string Name() const final {
+    return "NonOverlappingRectanglesEnergyPropagator";
+  }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -102,6 +106,9 @@ class NonOverlappingRectanglesDisjunctivePropagator
       NoOverlap2DConstraintHelper* helper, Model* model);
   ~NonOverlappingRectanglesDisjunctivePropagator() override;
 
+  std::string Name() const final {
+    return "NonOverlappingRectanglesDisjunctivePropagator";
+  }
   bool Propagate() final;
   void Register(int fast_priority, int slow_priority);
 
@@ -158,6 +165,7 @@ class RectanglePairwisePropagator : public PropagatorInterface {
 
   ~RectanglePairwisePropagator() override;
 
+  std::string Name() const final { return "RectanglePairwisePropagator"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
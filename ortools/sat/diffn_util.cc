@@ -645,10 +645,131 @@ void AppendPairwiseRestriction(const ItemWithVariableSize& item1,
   result->push_back(
       {.first_index = item1.index, .second_index = item2.index, .type = type});
 }
+
+// Below this number of pairs, it is faster to look at all of them than to use
+// the sweep of AppendNonSeparablePairs().
+constexpr int kMinNumPairsForSweep = 256;
+
+// Returns true if the two intervals cannot be separated, i.e. none of them can
+// be before the other.
+bool AreNonSeparable(const ItemWithVariableSize::Interval& a,
+                     const ItemWithVariableSize::Interval& b) {
+  return a.end_min > b.start_max && b.end_min > a.start_max;
+}
+
+// Appends to `pairs` all the pairs (i, j), i < j, such that intervals[i] and
+// intervals[j] are non-separable. If split is positive, only the pairs with
+// i < split <= j are considered. If skip_if_non_separable is not empty, the
+// pairs that are also non-separable in these intervals are skipped.
+//
+// We sweep over the [start_max, end_min) intervals of the tasks that have one.
+// Two such intervals are non-separable iff they overlap. A task with
+// start_max >= end_min is non-separable with another task iff the other
+// interval strictly contains [end_min, start_max], and two such tasks are
+// always separable. So this runs in O(n log n) plus the number of pairs with
+// one interval crossing the end_min of a task without one, which is much
+// better than looking at all pairs when most tasks are far apart.
+void AppendNonSeparablePairs(
+    absl::Span<const ItemWithVariableSize::Interval> intervals, int split,
+    absl::Span<const ItemWithVariableSize::Interval> skip_if_non_separable,
+    std::vector<std::pair<int, int>>* pairs) {
+  // At the same time, we process the ends, then the queries for the tasks
+  // without interval and then the starts.
+  enum EventType { kEnd = 0, kQuery = 1, kStart = 2 };
+  struct Event {
+    IntegerValue time;
+    EventType type;
+    int index;
+    bool operator<(const Event& other) const {
+      return std::tie(time, type) < std::tie(other.time, other.type);
+    }
+  };
+  const int num_intervals = intervals.size();
+  std::vector<Event> events;
+  events.reserve(2 * num_intervals);
+  for (int i = 0; i < num_intervals; ++i) {
+    const ItemWithVariableSize::Interval& interval = intervals[i];
+    if (interval.start_max < interval.end_min) {
+      events.push_back({interval.start_max, kStart, i});
+      events.push_back({interval.end_min, kEnd, i});
+    } else {
+      events.push_back({interval.end_min, kQuery, i});
+    }
+  }
+  std::sort(events.begin(), events.end());
+
+  const auto group = [split](int i) { return split > 0 && i >= split; };
+  const auto add_pair = [&](int i, int j) {
+    if (i > j) std::swap(i, j);
+    if (!skip_if_non_separable.empty() &&
+        AreNonSeparable(skip_if_non_separable[i], skip_if_non_separable[j])) {
+      return;
+    }
+    pairs->push_back({i, j});
+  };
+
+  // The intervals containing the current time, by group, with the position of
+  // each of them in its group for O(1) removal.
+  std::vector<int> active[2];
+  std::vector<int> position(num_intervals);
+  for (const Event& event : events) {
+    const int i = event.index;
+    const bool g = group(i);
+    const bool other_group = split > 0 ? !g : g;
+    switch (event.type) {
+      case kEnd: {
+        std::vector<int>& list = active[g];
+        const int last = list.back();
+        list[position[i]] = last;
+        position[last] = position[i];
+        list.pop_back();
+        break;
+      }
+      case kQuery:
+        for (const int j : active[other_group]) {
+          if (intervals[j].end_min > intervals[i].start_max) add_pair(i, j);
+        }
+        break;
+      case kStart:
+        for (const int j : active[other_group]) add_pair(i, j);
+        position[i] = active[g].size();
+        active[g].push_back(i);
+        break;
+    }
+  }
+}
+
+// Appends the restrictions between the items [0, split) and [split, n) if
+// split is positive, or between all the items otherwise. If two items are
+// separable in both dimensions, nothing can be deduced, so we only look at the
+// non-separable pairs in at least one dimension.
+void AppendPairwiseRestrictionsWithSweep(
+    absl::Span<const ItemWithVariableSize> items, int split,
+    std::vector<PairwiseRestriction>* result) {
+  std::vector<ItemWithVariableSize::Interval> x_intervals;
+  std::vector<ItemWithVariableSize::Interval> y_intervals;
+  x_intervals.reserve(items.size());
+  y_intervals.reserve(items.size());
+  for (const ItemWithVariableSize& item : items) {
+    x_intervals.push_back(item.x);
+    y_intervals.push_back(item.y);
+  }
+  std::vector<std::pair<int, int>> pairs;
+  AppendNonSeparablePairs(x_intervals, split, {}, &pairs);
+  AppendNonSeparablePairs(y_intervals, split, x_intervals, &pairs);
+  for (const auto [i, j] : pairs) {
+    AppendPairwiseRestriction(items[i], items[j], result);
+  }
+}
 }  // namespace
 
 void AppendPairwiseRestrictions(absl::Span<const ItemWithVariableSize> items,
                                 std::vector<PairwiseRestriction>* result) {
+  const int64_t num_items = items.size();
+  if (num_items * (num_items - 1) / 2 >= kMinNumPairsForSweep) {
+    AppendPairwiseRestrictionsWithSweep(items, /*split=*/0, result);
+    return;
+  }
   for (int i1 = 0; i1 + 1 < items.size(); ++i1) {
     for (int i2 = i1 + 1; i2 < items.size(); ++i2) {
       AppendPairwiseRestriction(items[i1], items[i2], result);
@@ -660,6 +781,15 @@ void AppendPairwiseRestrictions(
     absl::Span<const ItemWithVariableSize> items,
     absl::Span<const ItemWithVariableSize> other_items,
     std::vector<PairwiseRestriction>* result) {
+  if (!items.empty() && !other_items.empty() &&
+      static_cast<int64_t>(items.size()) * other_items.size() >=
+          kMinNumPairsForSweep) {
+    std::vector<ItemWithVariableSize> all_items(items.begin(), items.end());
+    all_items.insert(all_items.end(), other_items.begin(), other_items.end());
+    AppendPairwiseRestrictionsWithSweep(all_items, /*split=*/items.size(),
+                                        result);
+    return;
+  }
   for (int i1 = 0; i1 < items.size(); ++i1) {
     for (int i2 = 0; i2 < other_items.size(); ++i2) {
       AppendPairwiseRestriction(items[i1], other_items[i2], result);
@@ -1185,6 +1185,53 @@ TEST(FindPairwiseRestrictionsTest, Random) {
   }
 }
 
+ItemWithVariableSize::Interval RandomInterval(absl::BitGenRef random) {
+  const int start_min = absl::Uniform(random, 0, 100);
+  const int start_max = start_min + absl::Uniform(random, 0, 20);
+  const int size = absl::Uniform(random, 0, 15);
+  return {.start_min = IntegerValue(start_min),
+          .start_max = IntegerValue(start_max),
+          .end_min = IntegerValue(start_min + size),
+          .end_max = IntegerValue(start_max + size)};
+}
+
+// With many items, the restrictions are found with a sweep. This compares them
+// with the ones found by looking at each pair separately.
+TEST(FindPairwiseRestrictionsTest, SweepFindsAllRestrictions) {
+  absl::BitGen random;
+  for (int run = 0; run < 100; ++run) {
+    std::vector<ItemWithVariableSize> items(absl::Uniform(random, 30, 150));
+    for (int i = 0; i < items.size(); ++i) {
+      items[i] = {.index = i,
+                  .x = RandomInterval(random),
+                  .y = RandomInterval(random)};
+    }
+    const int split = absl::Uniform(random, 1, static_cast<int>(items.size()));
+    const absl::Span<const ItemWithVariableSize> first =
+        absl::MakeConstSpan(items).subspan(0, split);
+    const absl::Span<const ItemWithVariableSize> second =
+        absl::MakeConstSpan(items).subspan(split);
+
+    std::vector<PairwiseRestriction> expected_all;
+    std::vector<PairwiseRestriction> expected_cross;
+    for (int i = 0; i < items.size(); ++i) {
+      for (int j = i + 1; j < items.size(); ++j) {
+        AppendPairwiseRestrictions({items[i]}, {items[j]}, &expected_all);
+        if (i < split && j >= split) {
+          AppendPairwiseRestrictions({items[i]}, {items[j]}, &expected_cross);
+        }
+      }
+    }
+
+    std::vector<PairwiseRestriction> all;
+    AppendPairwiseRestrictions(items, &all);
+    EXPECT_THAT(all, UnorderedElementsAreArray(expected_all));
+    std::vector<PairwiseRestriction> cross;
+    AppendPairwiseRestrictions(first, second, &cross);
+    EXPECT_THAT(cross, UnorderedElementsAreArray(expected_cross));
+  }
+}
+
 void BM_FindPairwiseRestrictions(benchmark::State& state) {
   absl::BitGen random;
   // In the vast majority of the cases the propagator doesn't find any pairwise
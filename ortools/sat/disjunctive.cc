@@ -21,6 +21,7 @@
 #include "absl/log/check.h"
 #include "absl/log/log.h"
 #include "absl/types/span.h"
+#include "ortools/base/iterator_adaptors.h"
 #include "ortools/sat/all_different.h"
 #include "ortools/sat/integer.h"
 #include "ortools/sat/integer_base.h"
@@ -616,7 +617,7 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
     }
   }
   if (num_events <= 1) return true;
-  theta_tree_.Reset(num_events);
+  theta_tree_->Reset(num_events);
 
   // Introduce events by increasing end_max, check for overloads.
   // If end_max is the same, we want to add high start-min first.
@@ -638,25 +639,26 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
         // TODO(user): Add max energy deduction for variable
         // sizes by putting the energy_max here and modifying the code
         // dealing with the optional envelope greater than current_end below.
-        theta_tree_.AddOrUpdateEvent(current_event, window_[current_event].time,
-                                     energy_min, energy_min);
+        theta_tree_->AddOrUpdateEvent(current_event,
+                                      window_[current_event].time, energy_min,
+                                      energy_min);
       } else {
-        theta_tree_.AddOrUpdateOptionalEvent(
+        theta_tree_->AddOrUpdateOptionalEvent(
             current_event, window_[current_event].time, energy_min);
       }
     }
 
     const IntegerValue current_end = task_time.time;
-    if (theta_tree_.GetEnvelope() > current_end) {
+    if (theta_tree_->GetEnvelope() > current_end) {
       // Explain failure with tasks in critical interval.
       helper_->ClearReason();
       const int critical_event =
-          theta_tree_.GetMaxEventWithEnvelopeGreaterThan(current_end);
+          theta_tree_->GetMaxEventWithEnvelopeGreaterThan(current_end);
       const IntegerValue window_start = window_[critical_event].time;
       const IntegerValue window_end =
-          theta_tree_.GetEnvelopeOf(critical_event) - 1;
+          theta_tree_->GetEnvelopeOf(critical_event) - 1;
       for (int event = critical_event; event < num_events; event++) {
-        const IntegerValue energy_min = theta_tree_.EnergyMin(event);
+        const IntegerValue energy_min = theta_tree_->EnergyMin(event);
         if (energy_min > 0) {
           const int task = window_[event].task_index;
           helper_->AddPresenceReason(task);
@@ -668,7 +670,7 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
     }
 
     // Exclude all optional tasks that would overload an interval ending here.
-    while (theta_tree_.GetOptionalEnvelope() > current_end) {
+    while (theta_tree_->GetOptionalEnvelope() > current_end) {
       // Explain exclusion with tasks present in the critical interval.
       // TODO(user): This could be done lazily, like most of the loop to
       // compute the reasons in this file.
@@ -676,7 +678,7 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
       int critical_event;
       int optional_event;
       IntegerValue available_energy;
-      theta_tree_.GetEventsWithOptionalEnvelopeGreaterThan(
+      theta_tree_->GetEventsWithOptionalEnvelopeGreaterThan(
           current_end, &critical_event, &optional_event, &available_energy);
 
       const int optional_task = window_[optional_event].task_index;
@@ -689,7 +691,7 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
         const IntegerValue window_end =
             current_end + optional_size_min - available_energy - 1;
         for (int event = critical_event; event < num_events; event++) {
-          const IntegerValue energy_min = theta_tree_.EnergyMin(event);
+          const IntegerValue energy_min = theta_tree_->EnergyMin(event);
           if (energy_min > 0) {
             const int task = window_[event].task_index;
             helper_->AddPresenceReason(task);
@@ -706,7 +708,7 @@ bool DisjunctiveOverloadChecker::PropagateSubwindow(
         if (!helper_->PushTaskAbsence(optional_task)) return false;
       }
 
-      theta_tree_.RemoveEvent(optional_event);
+      theta_tree_->RemoveEvent(optional_event);
     }
   }
 
@@ -1557,6 +1559,7 @@ bool DisjunctiveEdgeFinding::Propagate() {
     return false;
   }
   is_gray_.resize(num_tasks, false);
+  is_selected_.resize(num_tasks, false);
   non_gray_task_to_event_.resize(num_tasks);
 
   window_.clear();
@@ -1613,10 +1616,10 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
     //
     // Same for task with an end-max that is too large: Tasks that are not
     // present can never trigger propagation or an overload checking failure.
-    // theta_tree_.GetOptionalEnvelope() is always <= window_end, so tasks whose
-    // end_max is >= window_end can never trigger propagation or failure either.
-    // Thus, those tasks can be marked as gray, which removes their contribution
-    // to theta right away.
+    // theta_tree_->GetOptionalEnvelope() is always <= window_end, so tasks
+    // whose end_max is >= window_end can never trigger propagation or failure
+    // either. Thus, those tasks can be marked as gray, which removes their
+    // contribution to theta right away.
     const IntegerValue end_max = helper_->EndMax(task);
     if (helper_->IsPresent(task) && end_max < window_end_min) {
       is_gray_[task] = false;
@@ -1629,8 +1632,25 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
   // If we have just 1 non-gray task, then this propagator does not propagate
   // more than the detectable precedences, so we abort early.
   if (task_by_increasing_end_max_.size() < 2) return true;
-  std::sort(task_by_increasing_end_max_.begin(),
-            task_by_increasing_end_max_.end());
+  if (4 * task_by_increasing_end_max_.size() >= helper_->NumTasks()) {
+    // For a large window, it is faster to filter the end-max order that the
+    // helper maintains incrementally, and that is shared by all the
+    // propagators using this helper, than to sort the window.
+    for (const TaskTime task_time : task_by_increasing_end_max_) {
+      is_selected_[task_time.task_index] = true;
+    }
+    task_by_increasing_end_max_.clear();
+    const auto by_decreasing_end_max = helper_->TaskByDecreasingEndMax();
+    for (const TaskTime task_time :
+         ::gtl::reversed_view(by_decreasing_end_max)) {
+      if (!is_selected_[task_time.task_index]) continue;
+      is_selected_[task_time.task_index] = false;
+      task_by_increasing_end_max_.push_back(task_time);
+    }
+  } else {
+    std::sort(task_by_increasing_end_max_.begin(),
+              task_by_increasing_end_max_.end());
+  }
 
   // Set up theta tree.
   //
@@ -1643,18 +1663,18 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
   // than calling AddOrUpdate() n times.
   const int window_size = window_.size();
   event_size_.clear();
-  theta_tree_.Reset(window_size);
+  theta_tree_->Reset(window_size);
   for (int event = 0; event < window_size; ++event) {
     const TaskTime task_time = window_[event];
     const int task = task_time.task_index;
     const IntegerValue energy_min = helper_->SizeMin(task);
     event_size_.push_back(energy_min);
     if (is_gray_[task]) {
-      theta_tree_.AddOrUpdateOptionalEvent(event, task_time.time, energy_min);
+      theta_tree_->AddOrUpdateOptionalEvent(event, task_time.time, energy_min);
     } else {
       non_gray_task_to_event_[task] = event;
-      theta_tree_.AddOrUpdateEvent(event, task_time.time, energy_min,
-                                   energy_min);
+      theta_tree_->AddOrUpdateEvent(event, task_time.time, energy_min,
+                                    energy_min);
     }
   }
 
@@ -1666,16 +1686,16 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
         task_by_increasing_end_max_.back().time;
 
     // Overload checking.
-    const IntegerValue non_gray_end_min = theta_tree_.GetEnvelope();
+    const IntegerValue non_gray_end_min = theta_tree_->GetEnvelope();
     if (non_gray_end_min > non_gray_end_max) {
       helper_->ClearReason();
 
       // We need the reasons for the critical tasks to fall in:
       const int critical_event =
-          theta_tree_.GetMaxEventWithEnvelopeGreaterThan(non_gray_end_max);
+          theta_tree_->GetMaxEventWithEnvelopeGreaterThan(non_gray_end_max);
       const IntegerValue window_start = window_[critical_event].time;
       const IntegerValue window_end =
-          theta_tree_.GetEnvelopeOf(critical_event) - 1;
+          theta_tree_->GetEnvelopeOf(critical_event) - 1;
       for (int event = critical_event; event < window_size; event++) {
         const int task = window_[event].task_index;
         if (is_gray_[task]) continue;
@@ -1695,12 +1715,12 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
     // Then the gray task must be after all the critical tasks (all the non-gray
     // tasks in the tree actually), otherwise there will be no way to schedule
     // the critical_tasks inside their time window.
-    while (theta_tree_.GetOptionalEnvelope() > non_gray_end_max) {
-      const IntegerValue end_min_with_gray = theta_tree_.GetOptionalEnvelope();
+    while (theta_tree_->GetOptionalEnvelope() > non_gray_end_max) {
+      const IntegerValue end_min_with_gray = theta_tree_->GetOptionalEnvelope();
       int critical_event_with_gray;
       int gray_event;
       IntegerValue available_energy;
-      theta_tree_.GetEventsWithOptionalEnvelopeGreaterThan(
+      theta_tree_->GetEventsWithOptionalEnvelopeGreaterThan(
           non_gray_end_max, &critical_event_with_gray, &gray_event,
           &available_energy);
       const int gray_task = window_[gray_event].task_index;
@@ -1709,7 +1729,7 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
       // This might happen in the corner case where more than one interval are
       // controlled by the same Boolean.
       if (helper_->IsAbsent(gray_task)) {
-        theta_tree_.RemoveEvent(gray_event);
+        theta_tree_->RemoveEvent(gray_event);
         continue;
       }
 
@@ -1718,8 +1738,8 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
         // The API is not ideal here. We just want the start of the critical
         // tasks that explain the non_gray_end_min computed above.
         const int critical_event =
-            theta_tree_.GetMaxEventWithEnvelopeGreaterThan(non_gray_end_min -
-                                                           1);
+            theta_tree_->GetMaxEventWithEnvelopeGreaterThan(
+                non_gray_end_min - 1);
 
         // Even if we need less task to explain the overload, because we are
         // going to explain the full non_gray_end_min, we can relax the
@@ -1807,7 +1827,7 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
       }
 
       // Remove the gray_task.
-      theta_tree_.RemoveEvent(gray_event);
+      theta_tree_->RemoveEvent(gray_event);
     }
 
     // Stop before we get just one non-gray task.
@@ -1815,7 +1835,7 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
 
     // Stop if the min of end_max is too big.
     if (task_by_increasing_end_max_[0].time >=
-        theta_tree_.GetOptionalEnvelope()) {
+        theta_tree_->GetOptionalEnvelope()) {
       break;
     }
 
@@ -1825,9 +1845,9 @@ bool DisjunctiveEdgeFinding::PropagateSubwindow(IntegerValue window_end_min) {
     const int new_gray_event = non_gray_task_to_event_[new_gray_task];
     DCHECK(!is_gray_[new_gray_task]);
     is_gray_[new_gray_task] = true;
-    theta_tree_.AddOrUpdateOptionalEvent(new_gray_event,
-                                         window_[new_gray_event].time,
-                                         event_size_[new_gray_event]);
+    theta_tree_->AddOrUpdateOptionalEvent(new_gray_event,
+                                          window_[new_gray_event].time,
+                                          event_size_[new_gray_event]);
   }
 
   return true;
@@ -126,6 +126,16 @@ class TaskSet {
   mutable int optimized_restart_ = 0;
 };
 
+// Returns the theta-lambda tree shared by all the disjunctive propagators of
+// the given model, or owned_tree if the model is null. Propagators never run
+// concurrently and each usage starts with a Reset(), so sharing it avoids
+// keeping one tree per propagator and per constraint warm in the cache.
+inline ThetaLambdaTree<IntegerValue>* SharedThetaLambdaTree(
+    Model* model, ThetaLambdaTree<IntegerValue>* owned_tree) {
+  if (model == nullptr) return owned_tree;
+  return model->GetOrCreate<ThetaLambdaTree<IntegerValue>>();
+}
+
 // Simple class to display statistics at the end if --v=1.
 struct PropagationStatistics {
   explicit PropagationStatistics(std::string _name, Model* model = nullptr)
@@ -186,10 +196,12 @@ class DisjunctiveOverloadChecker : public PropagatorInterface {
       : helper_(helper),
         window_(new TaskTime[helper->NumTasks()]),
         task_to_event_(new int[helper->NumTasks()]),
+        theta_tree_(SharedThetaLambdaTree(model, &owned_theta_tree_)),
         stats_("DisjunctiveOverloadChecker", model) {
     task_by_increasing_end_max_.ClearAndReserve(helper->NumTasks());
   }
 
+  std::string Name() const final { return "DisjunctiveOverloadChecker"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -204,7 +216,8 @@ class DisjunctiveOverloadChecker : public PropagatorInterface {
 
   FixedCapacityVector<TaskTime> task_by_increasing_end_max_;
 
-  ThetaLambdaTree<IntegerValue> theta_tree_;
+  ThetaLambdaTree<IntegerValue> owned_theta_tree_;
+  ThetaLambdaTree<IntegerValue>* theta_tree_;
   PropagationStatistics stats_;
 };
 
@@ -220,6 +233,7 @@ class DisjunctiveSimplePrecedences : public PropagatorInterface {
   explicit DisjunctiveSimplePrecedences(SchedulingConstraintHelper* helper,
                                         Model* model = nullptr)
       : helper_(helper), stats_("DisjunctiveSimplePrecedences", model) {}
+  std::string Name() const final { return "DisjunctiveSimplePrecedences"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -243,6 +257,7 @@ class DisjunctiveDetectablePrecedences : public PropagatorInterface {
     ranks_.resize(helper->NumTasks());
     to_add_.ClearAndReserve(helper->NumTasks());
   }
+  std::string Name() const final { return "DisjunctiveDetectablePrecedences"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -271,6 +286,7 @@ class CombinedDisjunctive : public PropagatorInterface {
   // in the model.
   void AddNoOverlap(absl::Span<const IntervalVariable> var);
 
+  std::string Name() const final { return "CombinedDisjunctive"; }
   bool Propagate() final;
 
  private:
@@ -292,6 +308,7 @@ class DisjunctiveNotLast : public PropagatorInterface {
     start_min_window_.ClearAndReserve(helper->NumTasks());
     start_max_window_.ClearAndReserve(helper->NumTasks());
   }
+  std::string Name() const final { return "DisjunctiveNotLast"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -314,11 +331,13 @@ class DisjunctiveEdgeFinding : public PropagatorInterface {
                          Model* model = nullptr)
       : time_direction_(time_direction),
         helper_(helper),
+        theta_tree_(SharedThetaLambdaTree(model, &owned_theta_tree_)),
         stats_("DisjunctiveEdgeFinding", model) {
     task_by_increasing_end_max_.ClearAndReserve(helper->NumTasks());
     window_.ClearAndReserve(helper->NumTasks());
     event_size_.ClearAndReserve(helper->NumTasks());
   }
+  std::string Name() const final { return "DisjunctiveEdgeFinding"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -333,12 +352,15 @@ class DisjunctiveEdgeFinding : public PropagatorInterface {
 
   // All these member are indexed in the same way.
   FixedCapacityVector<TaskTime> window_;
-  ThetaLambdaTree<IntegerValue> theta_tree_;
   FixedCapacityVector<IntegerValue> event_size_;
 
+  ThetaLambdaTree<IntegerValue> owned_theta_tree_;
+  ThetaLambdaTree<IntegerValue>* theta_tree_;
+
   // Task indexed.
   std::vector<int> non_gray_task_to_event_;
   std::vector<bool> is_gray_;
+  std::vector<bool> is_selected_;
 
   PropagationStatistics stats_;
 };
@@ -360,6 +382,7 @@ class DisjunctivePrecedences : public PropagatorInterface {
     indices_before_.ClearAndReserve(helper->NumTasks());
   }
 
+  std::string Name() const final { return "DisjunctivePrecedences"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -389,6 +412,7 @@ class DisjunctiveWithTwoItems : public PropagatorInterface {
  public:
   explicit DisjunctiveWithTwoItems(SchedulingConstraintHelper* helper)
       : helper_(helper) {}
+  std::string Name() const final { return "DisjunctiveWithTwoItems"; }
   bool Propagate() final;
   int RegisterWith(GenericLiteralWatcher* watcher);
 
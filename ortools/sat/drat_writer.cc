@@ -13,6 +13,7 @@
 
 #include "ortools/sat/drat_writer.h"
 
+#include <cstdint>
 #include <string>
 #if !defined(__PORTABLE_PLATFORM__)
 #include "ortools/base/file.h"
@@ -37,19 +38,36 @@ DratWriter::~DratWriter() {
 }
 
 void DratWriter::AddClause(absl::Span<const Literal> clause) {
+  if (in_binary_format_) buffer_ += 'a';
   WriteClause(clause);
 }
 
 void DratWriter::DeleteClause(absl::Span<const Literal> clause) {
-  buffer_ += "d ";
+  buffer_ += in_binary_format_ ? "d" : "d ";
   WriteClause(clause);
 }
 
 void DratWriter::WriteClause(absl::Span<const Literal> clause) {
-  for (const Literal literal : clause) {
-    absl::StrAppendFormat(&buffer_, "%d ", literal.SignedValue());
+  if (in_binary_format_) {
+    // Each literal is mapped to 2 * variable + is_negative, with 1-based
+    // variables, and written as a variable-length unsigned integer, 7 bits at a
+    // time with the high bit set on all bytes but the last one.
+    for (const Literal literal : clause) {
+      uint32_t value = 2 * (literal.Variable().value() + 1) +
+                       (literal.IsPositive() ? 0 : 1);
+      while (value > 127) {
+        buffer_ += static_cast<char>((value & 127) | 128);
+        value >>= 7;
+      }
+      buffer_ += static_cast<char>(value);
+    }
+    buffer_ += '\0';
+  } else {
+    for (const Literal literal : clause) {
+      absl::StrAppendFormat(&buffer_, "%d ", literal.SignedValue());
+    }
+    buffer_ += "0\n";
   }
-  buffer_ += "0\n";
   if (buffer_.size() > 10000) {
 #if !defined(__PORTABLE_PLATFORM__)
     CHECK_OK(file::WriteString(output_, buffer_, file::Defaults()));
@@ -47,7 +47,8 @@ class DratWriter {
  private:
   void WriteClause(absl::Span<const Literal> clause);
 
-  // TODO(user): Support binary format as proof in text format can be large.
+  // Whether to use the binary DRAT format, which is a lot more compact than the
+  // text one. See https://github.com/marijnheule/drat-trim#binary-drat-format.
   bool in_binary_format_;
   File* output_;
 
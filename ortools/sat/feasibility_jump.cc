@@ -768,6 +768,9 @@ bool FeasibilityJumpSolver::DoSomeLinearIterations() {
   jumps_.SetComputeFunction(
       absl::bind_front(&FeasibilityJumpSolver::ComputeLinearJump, this));
   RecomputeVarsToScan();
+  const int max_moves_per_scan = params_.feasibility_jump_max_moves_per_scan();
+  constraints_in_linear_batch_.ClearAndResize(
+      evaluator_->NumLinearConstraints());
 
   // Do a batch of a given dtime.
   // Outer loop: when no more greedy moves, update the weight.
@@ -785,23 +788,40 @@ bool FeasibilityJumpSolver::DoSomeLinearIterations() {
                                  &best_score)) {
         break;
       }
+      linear_batch_.clear();
+      linear_batch_.push_back({best_var, best_value, best_score});
+      if (max_moves_per_scan > 1) ExtendLinearBatch(max_moves_per_scan);
+
+      // Perform the moves. Because they share no constraint, the scores of the
+      // other moves of the batch are not changed by each update.
+      linear_batch_vars_.clear();
+      for (LinearMove& move : linear_batch_) {
+        ++state_->counters.num_linear_moves;
+        const int64_t prev_value = state_->solution[move.var];
+        state_->solution[move.var] = move.value;
+        evaluator_->UpdateLinearScores(
+            move.var, prev_value, move.value, state_->weights, jumps_.Deltas(),
+            jumps_.MutableScores(),
+            /*clear_affected_variables=*/linear_batch_vars_.empty());
+        evaluator_->UpdateViolatedList();
+        var_domains_.OnValueChange(move.var, move.value);
+        linear_batch_vars_.push_back(move.var);
+
+        // From now on, this is the undo move.
+        move.value = prev_value - move.value;
+        move.score = -move.score;
+      }
 
-      // Perform the move.
-      ++state_->counters.num_linear_moves;
-      const int64_t prev_value = state_->solution[best_var];
-      state_->solution[best_var] = best_value;
-      evaluator_->UpdateLinearScores(best_var, prev_value, best_value,
-                                     state_->weights, jumps_.Deltas(),
-                                     jumps_.MutableScores());
-      evaluator_->UpdateViolatedList();
-      var_domains_.OnValueChange(best_var, best_value);
-
-      MarkJumpsThatNeedToBeRecomputed(best_var);
-      if (var_domains_.HasTwoValues(best_var)) {
-        // We already know the score of undoing the move we just did, and that
-        // this is optimal.
-        jumps_.SetJump(best_var, prev_value - best_value, -best_score);
+      MarkJumpsThatNeedToBeRecomputed(linear_batch_vars_);
+      for (const LinearMove& undo : linear_batch_) {
+        if (var_domains_.HasTwoValues(undo.var)) {
+          // We already know the score of undoing the move we just did, and
+          // that this is optimal.
+          jumps_.SetJump(undo.var, undo.value, undo.score);
+        }
       }
+      for (const int var : rejected_batch_vars_) AddVarToScan(var);
+      rejected_batch_vars_.clear();
     }
     if (time_limit_crossed_) return false;
 
@@ -828,21 +848,24 @@ bool FeasibilityJumpSolver::DoSomeLinearIterations() {
 // TODO(user): For non-Boolean, we could easily detect if a non-improving
 // score cannot become improving. We don't need to add such variable to
 // the queue.
-void FeasibilityJumpSolver::MarkJumpsThatNeedToBeRecomputed(int changed_var) {
-  // To keep DCHECKs happy. Note that we migh overwrite this afterwards with the
-  // known score/jump of undoing the move.
-  jumps_.Recompute(changed_var);
-
-  // Generic part.
-  // No optimization there, we just update all touched variables.
-  // We need to do this before the Linear part, so that the status is correct in
-  // AddVarToScan() for variable with two values.
-  num_ops_ += evaluator_->VarToGeneralConstraints(changed_var).size();
-  for (const int c : evaluator_->VarToGeneralConstraints(changed_var)) {
-    num_ops_ += evaluator_->GeneralConstraintToVars(c).size();
-    for (const int var : evaluator_->GeneralConstraintToVars(c)) {
-      jumps_.Recompute(var);
-      AddVarToScan(var);
+void FeasibilityJumpSolver::MarkJumpsThatNeedToBeRecomputed(
+    absl::Span<const int> changed_vars) {
+  for (const int changed_var : changed_vars) {
+    // To keep DCHECKs happy. Note that we migh overwrite this afterwards with
+    // the known score/jump of undoing the move.
+    jumps_.Recompute(changed_var);
+
+    // Generic part.
+    // No optimization there, we just update all touched variables.
+    // We need to do this before the Linear part, so that the status is correct
+    // in AddVarToScan() for variable with two values.
+    num_ops_ += evaluator_->VarToGeneralConstraints(changed_var).size();
+    for (const int c : evaluator_->VarToGeneralConstraints(changed_var)) {
+      num_ops_ += evaluator_->GeneralConstraintToVars(c).size();
+      for (const int var : evaluator_->GeneralConstraintToVars(c)) {
+        jumps_.Recompute(var);
+        AddVarToScan(var);
+      }
     }
   }
 
@@ -936,7 +959,7 @@ bool FeasibilityJumpSolver::DoSomeGeneralIterations() {
                                        prev_value - new_value, false));
       }
 
-      MarkJumpsThatNeedToBeRecomputed(var);
+      MarkJumpsThatNeedToBeRecomputed({var});
       if (var_domains_.HasTwoValues(var)) {
         // We already know the score of the only possible move (undoing what we
         // just did).
@@ -1083,6 +1106,42 @@ bool FeasibilityJumpSolver::ScanRelevantVariables(int num_to_scan,
   return false;
 }
 
+void FeasibilityJumpSolver::ExtendLinearBatch(int max_moves) {
+  const LinearIncrementalEvaluator& linear_evaluator =
+      evaluator_->LinearEvaluator();
+  constraints_in_linear_batch_.ResetAllToFalse();
+  for (const int c : linear_evaluator.VarToConstraints(linear_batch_[0].var)) {
+    constraints_in_linear_batch_.Set(c);
+  }
+
+  // Note that the variables returned by ScanRelevantVariables() are removed
+  // from vars_to_scan_, so the rejected ones need to be added back once the
+  // batch is committed.
+  DCHECK(rejected_batch_vars_.empty());
+  for (int i = 1; i < max_moves; ++i) {
+    int var;
+    int64_t value;
+    double score;
+    if (!ScanRelevantVariables(/*num_to_scan=*/5, &var, &value, &score)) break;
+    const absl::Span<const int> constraints =
+        linear_evaluator.VarToConstraints(var);
+    num_ops_ += constraints.size();
+    bool is_independent = true;
+    for (const int c : constraints) {
+      if (constraints_in_linear_batch_[c]) {
+        is_independent = false;
+        break;
+      }
+    }
+    if (!is_independent) {
+      rejected_batch_vars_.push_back(var);
+      continue;
+    }
+    for (const int c : constraints) constraints_in_linear_batch_.Set(c);
+    linear_batch_.push_back({var, value, score});
+  }
+}
+
 void FeasibilityJumpSolver::AddVarToScan(int var) {
   DCHECK_GE(var, 0);
   if (in_vars_to_scan_[var]) return;
@@ -42,6 +42,7 @@
 #include "ortools/sat/subsolver.h"
 #include "ortools/sat/synchronization.h"
 #include "ortools/sat/util.h"
+#include "ortools/util/bitset.h"
 #include "ortools/util/sorted_interval_list.h"
 #include "ortools/util/time_limit.h"
 
@@ -546,8 +547,8 @@ class FeasibilityJumpSolver : public SubSolver {
   std::pair<int64_t, double> ComputeGeneralJump(int var);
 
   // Marks all variables whose jump value may have changed due to the last
-  // update, except for `changed var`.
-  void MarkJumpsThatNeedToBeRecomputed(int changed_var);
+  // updates, except for the `changed_vars`.
+  void MarkJumpsThatNeedToBeRecomputed(absl::Span<const int> changed_vars);
 
   // Moves.
   bool DoSomeLinearIterations();
@@ -557,6 +558,12 @@ class FeasibilityJumpSolver : public SubSolver {
   bool ScanRelevantVariables(int num_to_scan, int* var, int64_t* value,
                              double* score);
 
+  // Appends to linear_batch_ up to max_moves - 1 improving moves on variables
+  // that share no linear constraint with the other moves of the batch. The
+  // scores of such moves do not depend on each other, so they can all be
+  // committed. See feasibility_jump_max_moves_per_scan.
+  void ExtendLinearBatch(int max_moves);
+
   // Increases the weight of the currently infeasible constraints.
   // Ensures jumps remains consistent.
   void UpdateViolatedConstraintWeights();
@@ -625,6 +632,17 @@ class FeasibilityJumpSolver : public SubSolver {
 
   std::vector<int64_t> tmp_breakpoints_;
 
+  // The moves committed together by DoSomeLinearIterations().
+  struct LinearMove {
+    int var;
+    int64_t value;
+    double score;
+  };
+  std::vector<LinearMove> linear_batch_;
+  std::vector<int> linear_batch_vars_;
+  std::vector<int> rejected_batch_vars_;
+  SparseBitset<int> constraints_in_linear_batch_;
+
   // For counting the dtime. See DeterministicTime().
   int64_t num_ops_ = 0;
 };
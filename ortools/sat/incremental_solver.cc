@@ -0,0 +1,247 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/incremental_solver.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+#include "absl/memory/memory.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/span.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_checker.h"
+#include "ortools/sat/cp_model_loader.h"
+#include "ortools/sat/cp_model_mapping.h"
+#include "ortools/sat/cp_model_solver_helpers.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/sat/integer_search.h"
+#include "ortools/sat/model.h"
+#include "ortools/sat/optimization.h"
+#include "ortools/sat/sat_base.h"
+#include "ortools/sat/sat_parameters.pb.h"
+#include "ortools/sat/sat_solver.h"
+#include "ortools/util/sorted_interval_list.h"
+#include "ortools/util/time_limit.h"
+
+namespace operations_research {
+namespace sat {
+
+namespace {
+
+// Returns an error if the constraint has no direct propagator, see the class
+// comment.
+absl::Status CheckConstraintIsSupported(const ConstraintProto& ct) {
+  switch (ct.constraint_case()) {
+    case ConstraintProto::kBoolOr:
+    case ConstraintProto::kBoolAnd:
+    case ConstraintProto::kAtMostOne:
+    case ConstraintProto::kExactlyOne:
+    case ConstraintProto::kBoolXor:
+      return absl::OkStatus();
+    case ConstraintProto::kLinear: {
+      absl::flat_hash_set<int> vars;
+      for (const int ref : ct.linear().vars()) {
+        if (!vars.insert(PositiveRef(ref)).second) {
+          return absl::InvalidArgumentError(absl::StrCat(
+              "Linear constraint with duplicate variables: ", ref));
+        }
+      }
+      return absl::OkStatus();
+    }
+    default:
+      return absl::InvalidArgumentError(
+          absl::StrCat("Unsupported constraint type in an IncrementalSolver: ",
+                       ConstraintCaseName(ct.constraint_case())));
+  }
+}
+
+}  // namespace
+
+absl::StatusOr<std::unique_ptr<IncrementalSolver>> IncrementalSolver::Create(
+    const CpModelProto& model_proto, const SatParameters& params) {
+  const std::string error = ValidateCpModel(model_proto);
+  if (!error.empty()) return absl::InvalidArgumentError(error);
+  if (model_proto.has_objective() ||
+      model_proto.has_floating_point_objective()) {
+    return absl::InvalidArgumentError(
+        "An IncrementalSolver does not support objectives.");
+  }
+  for (const ConstraintProto& ct : model_proto.constraints()) {
+    const absl::Status status = CheckConstraintIsSupported(ct);
+    if (!status.ok()) return status;
+  }
+  return absl::WrapUnique(new IncrementalSolver(model_proto, params));
+}
+
+IncrementalSolver::IncrementalSolver(const CpModelProto& model_proto,
+                                     const SatParameters& params)
+    : model_proto_(model_proto), params_(params) {
+  // The parameters must be set before any solver class is created.
+  *model_.GetOrCreate<SatParameters>() = params_;
+  model_.GetOrCreate<TimeLimit>()->ResetLimitFromParameters(params_);
+  LoadCpModel(model_proto_, &model_);
+}
+
+absl::Status IncrementalSolver::ValidateNewConstraint(
+    const ConstraintProto& ct) const {
+  const absl::Status status = CheckConstraintIsSupported(ct);
+  if (!status.ok()) return status;
+
+  const int num_variables = model_proto_.variables_size();
+  const auto* mapping = model_.Get<CpModelMapping>();
+  const IndexReferences refs = GetReferencesUsedByConstraint(ct);
+  for (const int ref : refs.literals) {
+    if (PositiveRef(ref) >= num_variables || !mapping->IsBoolean(ref)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid literal: ", ref));
+    }
+  }
+  for (const int ref : ct.enforcement_literal()) {
+    if (PositiveRef(ref) >= num_variables || !mapping->IsBoolean(ref)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("Invalid enforcement literal: ", ref));
+    }
+  }
+  for (const int ref : refs.variables) {
+    if (PositiveRef(ref) >= num_variables || !mapping->IsInteger(ref)) {
+      return absl::InvalidArgumentError(absl::StrCat(
+          "Variable ", ref,
+          " is not an integer in the loaded model, use a Boolean constraint."));
+    }
+  }
+  if (ct.constraint_case() == ConstraintProto::kLinear) {
+    const LinearConstraintProto& linear = ct.linear();
+    if (linear.vars_size() != linear.coeffs_size() ||
+        linear.domain_size() % 2 != 0) {
+      return absl::InvalidArgumentError("Invalid linear constraint.");
+    }
+    if (PossibleIntegerOverflow(model_proto_, linear.vars(),
+                                linear.coeffs())) {
+      return absl::InvalidArgumentError(
+          "Possible integer overflow in linear constraint.");
+    }
+  }
+  return absl::OkStatus();
+}
+
+void IncrementalSolver::LoadAndPropagate(const ConstraintProto& ct) {
+  auto* sat_solver = model_.GetOrCreate<SatSolver>();
+  if (!sat_solver->ResetToLevelZero()) return;
+  LoadConstraint(ct, &model_);
+  sat_solver->FinishPropagation();
+}
+
+absl::Status IncrementalSolver::AddConstraint(const ConstraintProto& ct) {
+  const absl::Status status = ValidateNewConstraint(ct);
+  if (!status.ok()) return status;
+  *model_proto_.add_constraints() = ct;
+  LoadAndPropagate(ct);
+  return absl::OkStatus();
+}
+
+absl::Status IncrementalSolver::IntersectDomainWith(int var,
+                                                    const Domain& domain) {
+  if (var < 0 || var >= model_proto_.variables_size()) {
+    return absl::InvalidArgumentError(absl::StrCat("Invalid variable: ", var));
+  }
+  const auto* mapping = model_.Get<CpModelMapping>();
+  if (mapping->IsBoolean(var)) {
+    // Booleans might not have an integer view, so we fix them with a clause
+    // listing their allowed values. An empty clause makes the model unsat.
+    if (domain.Contains(0) && domain.Contains(1)) return absl::OkStatus();
+    ConstraintProto ct;
+    ct.mutable_bool_or();
+    if (domain.Contains(1)) ct.mutable_bool_or()->add_literals(var);
+    if (domain.Contains(0)) ct.mutable_bool_or()->add_literals(NegatedRef(var));
+    LoadAndPropagate(ct);
+    return absl::OkStatus();
+  }
+
+  ConstraintProto ct;
+  ct.mutable_linear()->add_vars(var);
+  ct.mutable_linear()->add_coeffs(1);
+  FillDomainInProto(domain, ct.mutable_linear());
+  LoadAndPropagate(ct);
+  return absl::OkStatus();
+}
+
+CpSolverResponse IncrementalSolver::Solve(absl::Span<const int> assumptions) {
+  CpSolverResponse response;
+  auto* sat_solver = model_.GetOrCreate<SatSolver>();
+  const auto* mapping = model_.Get<CpModelMapping>();
+  std::vector<Literal> literals;
+  for (const int ref : assumptions) {
+    if (PositiveRef(ref) >= model_proto_.variables_size() ||
+        !mapping->IsBoolean(ref)) {
+      response.set_status(CpSolverStatus::MODEL_INVALID);
+      response.set_solution_info(absl::StrCat("Invalid assumption: ", ref));
+      return response;
+    }
+    literals.push_back(mapping->Literal(ref));
+  }
+
+  auto* time_limit = model_.GetOrCreate<TimeLimit>();
+  time_limit->ResetLimitFromParameters(params_);
+
+  // LoadCpModel() only constructs the search strategies, the decision and
+  // restart policies used by the search must be configured from them. As in
+  // SolveLoadedCpModel(), we do it before each solve so that every call starts
+  // from the first policy.
+  ConfigureSearchHeuristics(&model_);
+  const SatSolver::Status status =
+      sat_solver->ModelIsUnsat()
+          ? SatSolver::INFEASIBLE
+          : ResetAndSolveIntegerProblem(literals, &model_);
+  switch (status) {
+    case SatSolver::FEASIBLE: {
+      // As for SolveCpModel(), a solution of a model without objective is
+      // optimal.
+      response.set_status(CpSolverStatus::OPTIMAL);
+      const std::vector<int64_t> solution =
+          GetSolutionValues(model_proto_, model_);
+      response.mutable_solution()->Assign(solution.begin(), solution.end());
+      break;
+    }
+    case SatSolver::ASSUMPTIONS_UNSAT: {
+      response.set_status(CpSolverStatus::INFEASIBLE);
+      std::vector<Literal> core = sat_solver->GetLastIncompatibleDecisions();
+      MinimizeCoreWithPropagation(time_limit, sat_solver, &core);
+      for (const Literal l : core) {
+        const int var =
+            mapping->GetProtoVariableFromBooleanVariable(l.Variable());
+        response.add_sufficient_assumptions_for_infeasibility(
+            l.IsPositive() ? var : NegatedRef(var));
+      }
+      break;
+    }
+    case SatSolver::INFEASIBLE:
+      response.set_status(CpSolverStatus::INFEASIBLE);
+      break;
+    default:
+      response.set_status(CpSolverStatus::UNKNOWN);
+      break;
+  }
+  response.set_num_conflicts(sat_solver->num_failures());
+  response.set_num_branches(sat_solver->num_branches());
+  response.set_deterministic_time(time_limit->GetElapsedDeterministicTime());
+  return response;
+}
+
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,95 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_INCREMENTAL_SOLVER_H_
+#define OR_TOOLS_SAT_INCREMENTAL_SOLVER_H_
+
+#include <memory>
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/types/span.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/model.h"
+#include "ortools/sat/sat_parameters.pb.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+
+// A CP-SAT solving session on a feasibility model that can be modified and
+// solved again many times, under different assumptions.
+//
+// Unlike SolveCpModel(), the model is loaded once, without presolve, and the
+// solver state is kept between the calls to Solve(): the learned clauses, the
+// variable activities and the literal encodings. Re-solving after a small
+// change is thus much faster than solving from scratch.
+//
+// The model can only grow more constrained: new constraints can be added and
+// the variable domains reduced, but nothing can be removed. Use assumptions for
+// the decisions that must be revisited. Since there is no presolve, only the
+// constraints with a direct propagator are supported: bool_or, bool_and,
+// at_most_one, exactly_one, bool_xor and linear (with distinct variables). The
+// model must not have an objective.
+//
+// This is single-threaded and not thread-safe.
+class IncrementalSolver {
+ public:
+  // Validates and loads the given model. Returns an error if the model is
+  // invalid or not supported.
+  static absl::StatusOr<std::unique_ptr<IncrementalSolver>> Create(
+      const CpModelProto& model_proto, const SatParameters& params = {});
+
+  // This type is neither copyable nor movable.
+  IncrementalSolver(const IncrementalSolver&) = delete;
+  IncrementalSolver& operator=(const IncrementalSolver&) = delete;
+
+  // Adds a constraint on the existing variables. Its linear variables must
+  // have a non-Boolean domain or appear in a linear constraint of the initial
+  // model. Returns an error and leaves the model unchanged if the constraint is
+  // invalid or not supported.
+  absl::Status AddConstraint(const ConstraintProto& ct);
+
+  // Reduces the domain of the given variable to its intersection with the given
+  // domain.
+  absl::Status IntersectDomainWith(int var, const Domain& domain);
+
+  // Searches for a solution where all the given literals are true. If there is
+  // none, the status is INFEASIBLE and sufficient_assumptions_for_infeasibility
+  // contains a subset of the assumptions that cannot be all true. The status is
+  // UNKNOWN if the time limit of the parameters is reached, this limit applies
+  // to each call.
+  CpSolverResponse Solve(absl::Span<const int> assumptions = {});
+
+  // The model with all the constraints added so far. The domains are the
+  // initial ones, the reductions are only applied in the solver.
+  const CpModelProto& model_proto() const { return model_proto_; }
+
+ private:
+  IncrementalSolver(const CpModelProto& model_proto,
+                    const SatParameters& params);
+
+  absl::Status ValidateNewConstraint(const ConstraintProto& ct) const;
+
+  // Loads the given constraint in model_ at level zero and propagates it.
+  void LoadAndPropagate(const ConstraintProto& ct);
+
+  CpModelProto model_proto_;
+  SatParameters params_;
+  Model model_;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_INCREMENTAL_SOLVER_H_
@@ -0,0 +1,183 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/incremental_solver.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ortools/base/gmock.h"
+#include "ortools/base/parse_test_proto.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_checker.h"
+#include "ortools/sat/sat_parameters.pb.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+using ::google::protobuf::contrib::parse_proto::ParseTestProto;
+using ::testing::UnorderedElementsAre;
+
+const char kModel[] = R"pb(
+  variables { domain: [ 0, 1 ] }
+  variables { domain: [ 0, 1 ] }
+  variables { domain: [ 0, 1 ] }
+  variables { domain: [ 0, 10 ] }
+  constraints { bool_or { literals: [ 0, 1 ] } }
+  constraints {
+    enforcement_literal: 2
+    linear {
+      vars: [ 3 ]
+      coeffs: [ 1 ]
+      domain: [ 3, 10 ]
+    }
+  }
+)pb";
+
+bool IsFeasible(const CpModelProto& model_proto,
+                const CpSolverResponse& response) {
+  const std::vector<int64_t> solution(response.solution().begin(),
+                                      response.solution().end());
+  return SolutionIsFeasible(model_proto, solution);
+}
+
+TEST(IncrementalSolverTest, SolveWithAssumptions) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  auto solver = IncrementalSolver::Create(model_proto);
+  ASSERT_TRUE(solver.ok());
+
+  CpSolverResponse response = (*solver)->Solve();
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_TRUE(IsFeasible(model_proto, response));
+
+  response = (*solver)->Solve({2, -1});
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_TRUE(IsFeasible(model_proto, response));
+  EXPECT_EQ(response.solution(0), 0);
+  EXPECT_EQ(response.solution(2), 1);
+  EXPECT_GE(response.solution(3), 3);
+
+  // Only the first two assumptions are incompatible.
+  response = (*solver)->Solve({-1, 2, -2});
+  EXPECT_EQ(response.status(), CpSolverStatus::INFEASIBLE);
+  EXPECT_THAT(response.sufficient_assumptions_for_infeasibility(),
+              UnorderedElementsAre(-1, -2));
+
+  // The assumptions do not change the model.
+  response = (*solver)->Solve();
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+}
+
+TEST(IncrementalSolverTest, AddConstraint) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  auto solver = IncrementalSolver::Create(model_proto);
+  ASSERT_TRUE(solver.ok());
+
+  const ConstraintProto linear = ParseTestProto(R"pb(
+    enforcement_literal: 0
+    linear {
+      vars: [ 3 ]
+      coeffs: [ 1 ]
+      domain: [ 0, 2 ]
+    }
+  )pb");
+  ASSERT_TRUE((*solver)->AddConstraint(linear).ok());
+  EXPECT_EQ((*solver)->model_proto().constraints_size(), 3);
+
+  // x0 and x2 cannot be both true anymore.
+  CpSolverResponse response = (*solver)->Solve({0, 2});
+  EXPECT_EQ(response.status(), CpSolverStatus::INFEASIBLE);
+  EXPECT_THAT(response.sufficient_assumptions_for_infeasibility(),
+              UnorderedElementsAre(0, 2));
+  response = (*solver)->Solve({2});
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_TRUE(IsFeasible((*solver)->model_proto(), response));
+
+  const ConstraintProto clause = ParseTestProto(R"pb(
+    bool_and { literals: [ -1, -2 ] }
+  )pb");
+  ASSERT_TRUE((*solver)->AddConstraint(clause).ok());
+  EXPECT_EQ((*solver)->Solve().status(), CpSolverStatus::INFEASIBLE);
+}
+
+TEST(IncrementalSolverTest, IntersectDomainWith) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  auto solver = IncrementalSolver::Create(model_proto);
+  ASSERT_TRUE(solver.ok());
+
+  ASSERT_TRUE((*solver)->IntersectDomainWith(3, Domain(0, 5)).ok());
+  CpSolverResponse response = (*solver)->Solve({2});
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_GE(response.solution(3), 3);
+  EXPECT_LE(response.solution(3), 5);
+
+  ASSERT_TRUE((*solver)->IntersectDomainWith(2, Domain(0)).ok());
+  response = (*solver)->Solve({2});
+  EXPECT_EQ(response.status(), CpSolverStatus::INFEASIBLE);
+  response = (*solver)->Solve();
+  EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+  EXPECT_EQ(response.solution(2), 0);
+
+  ASSERT_TRUE((*solver)->IntersectDomainWith(3, Domain(6, 10)).ok());
+  EXPECT_EQ((*solver)->Solve().status(), CpSolverStatus::INFEASIBLE);
+}
+
+TEST(IncrementalSolverTest, SolveWithFixedSearch) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  SatParameters params;
+  params.set_search_branching(SatParameters::FIXED_SEARCH);
+  auto solver = IncrementalSolver::Create(model_proto, params);
+  ASSERT_TRUE(solver.ok());
+  for (int i = 0; i < 3; ++i) {
+    const CpSolverResponse response = (*solver)->Solve({2});
+    EXPECT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+    EXPECT_TRUE(IsFeasible(model_proto, response));
+  }
+}
+
+TEST(IncrementalSolverTest, UnsupportedModelsAndConstraints) {
+  CpModelProto model_proto = ParseTestProto(kModel);
+  model_proto.mutable_objective()->add_vars(3);
+  model_proto.mutable_objective()->add_coeffs(1);
+  EXPECT_FALSE(IncrementalSolver::Create(model_proto).ok());
+
+  model_proto = ParseTestProto(kModel);
+  model_proto.add_constraints()->mutable_all_diff();
+  EXPECT_FALSE(IncrementalSolver::Create(model_proto).ok());
+
+  model_proto = ParseTestProto(kModel);
+  auto solver = IncrementalSolver::Create(model_proto);
+  ASSERT_TRUE(solver.ok());
+  const ConstraintProto out_of_range = ParseTestProto(R"pb(
+    bool_or { literals: [ 0, 4 ] }
+  )pb");
+  EXPECT_FALSE((*solver)->AddConstraint(out_of_range).ok());
+  const ConstraintProto duplicates = ParseTestProto(R"pb(
+    linear {
+      vars: [ 3, 3 ]
+      coeffs: [ 1, 1 ]
+      domain: [ 0, 4 ]
+    }
+  )pb");
+  EXPECT_FALSE((*solver)->AddConstraint(duplicates).ok());
+  EXPECT_EQ((*solver)->model_proto().constraints_size(), 2);
+  EXPECT_FALSE((*solver)->IntersectDomainWith(4, Domain(0)).ok());
+  EXPECT_EQ((*solver)->Solve({4}).status(), CpSolverStatus::MODEL_INVALID);
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
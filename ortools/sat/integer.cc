@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "absl/base/optimization.h"
 #include "absl/cleanup/cleanup.h"
 #include "absl/container/btree_map.h"
 #include "absl/container/flat_hash_map.h"
@@ -31,6 +32,7 @@
 #include "absl/log/check.h"
 #include "absl/meta/type_traits.h"
 #include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
 #include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/strong_vector.h"
@@ -2092,6 +2094,74 @@ GenericLiteralWatcher::GenericLiteralWatcher(Model* model)
       &id_to_greatest_common_level_since_last_call_);
   integer_trail_->RegisterWatcher(&modified_vars_);
   queue_by_priority_.resize(2);  // Because default priority is 1.
+
+  const int sampling_period =
+      model->GetOrCreate<SatParameters>()->propagator_stats_sampling_period();
+  if (sampling_period > 0) EnablePropagatorStats(sampling_period);
+}
+
+void GenericLiteralWatcher::EnablePropagatorStats(int sampling_period) {
+  DCHECK_GT(sampling_period, 0);
+  collect_propagator_stats_ = true;
+  propagator_stats_sampling_period_ = sampling_period;
+}
+
+std::vector<PropagatorStats> GenericLiteralWatcher::GetPropagatorStats()
+    const {
+  std::vector<PropagatorStats> result = propagator_stats_;
+  std::stable_sort(result.begin(), result.end(),
+                   [](const PropagatorStats& a, const PropagatorStats& b) {
+                     return a.EstimatedSeconds() > b.EstimatedSeconds();
+                   });
+  return result;
+}
+
+bool GenericLiteralWatcher::CallPropagatorAndCollectStats(int id,
+                                                          const Trail& trail) {
+  int& index = id_to_stats_index_[id];
+  if (index == -1) {
+    std::string name = watchers_[id]->Name();
+    const auto [it, inserted] =
+        name_to_stats_index_.insert({name, propagator_stats_.size()});
+    if (inserted) {
+      propagator_stats_.push_back(PropagatorStats());
+      propagator_stats_.back().name = std::move(name);
+    }
+    index = it->second;
+  }
+  PropagatorStats& stats = propagator_stats_[index];
+
+  const int64_t old_integer_timestamp = integer_trail_->num_enqueues();
+  const int64_t old_boolean_timestamp = trail.Index();
+  const int64_t old_num_reason_elements =
+      integer_trail_->NumStoredReasonElements();
+
+  // absl::GetCurrentTimeNanos() uses the cycle counter when possible, but this
+  // is still too slow to be done on each call of the small propagators.
+  const bool timed = stats.num_calls % propagator_stats_sampling_period_ == 0;
+  ++stats.num_calls;
+  const int64_t start_nanos = timed ? absl::GetCurrentTimeNanos() : 0;
+  const bool result = CallPropagator(id);
+  if (timed) {
+    ++stats.num_timed_calls;
+    stats.timed_nanos += absl::GetCurrentTimeNanos() - start_nanos;
+  }
+
+  const int64_t num_integer_pushes =
+      integer_trail_->num_enqueues() - old_integer_timestamp;
+  const int64_t num_literal_pushes = trail.Index() - old_boolean_timestamp;
+  stats.num_integer_pushes += num_integer_pushes;
+  stats.num_literal_pushes += num_literal_pushes;
+  stats.num_reason_elements +=
+      std::max(int64_t{0}, integer_trail_->NumStoredReasonElements() -
+                               old_num_reason_elements);
+  if (!result) {
+    ++stats.num_conflicts;
+    stats.num_conflict_literals += trail.FailingClause().size();
+  } else if (num_integer_pushes == 0 && num_literal_pushes == 0) {
+    ++stats.num_calls_without_push;
+  }
+  return result;
 }
 
 void GenericLiteralWatcher::ReserveSpaceForNumVariables(int num_vars) {
@@ -2217,12 +2287,10 @@ bool GenericLiteralWatcher::Propagate(Trail* trail) {
       current_id_ = id;
       call_again_ = false;
 
-      // TODO(user): Maybe just provide one function Propagate(watch_indices) ?
       ++num_propagate_calls;
-      const bool result =
-          id_to_watch_indices_[id].empty()
-              ? watchers_[id]->Propagate()
-              : watchers_[id]->IncrementalPropagate(id_to_watch_indices_[id]);
+      const bool result = ABSL_PREDICT_FALSE(collect_propagator_stats_)
+                              ? CallPropagatorAndCollectStats(id, *trail)
+                              : CallPropagator(id);
       if (!result) {
         id_to_watch_indices_[id].clear();
         in_queue_[id] = false;
@@ -2336,6 +2404,7 @@ int GenericLiteralWatcher::Register(PropagatorInterface* propagator) {
   id_to_watch_indices_.push_back(std::vector<int>());
   id_to_priority_.push_back(1);
   id_to_idempotence_.push_back(true);
+  id_to_stats_index_.push_back(-1);
 
   // Call this propagator at least once the next time Propagate() is called.
   //
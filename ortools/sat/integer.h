@@ -700,6 +700,12 @@ class IntegerTrail final : public SatPropagator {
   // Same as num_enqueues but only count the level zero changes.
   int64_t num_level_zero_enqueues() const { return num_level_zero_enqueues_; }
 
+  // The number of literals and bounds in the eager reasons of the current
+  // trail. This is used to measure the size of the reasons of a propagator.
+  int64_t NumStoredReasonElements() const {
+    return literals_reason_buffer_.size() + bounds_reason_buffer_.size();
+  }
+
   // All the registered bitsets will be set to one each time a LbVar is
   // modified. It is up to the client to clear it if it wants to be notified
   // with the newly modified variables.
@@ -1080,6 +1086,48 @@ class PropagatorInterface {
     LOG(FATAL) << "Not implemented.";
     return false;  // Remove warning in Windows
   }
+
+  // The statistics of the propagators with the same name are aggregated, see
+  // GenericLiteralWatcher::GetPropagatorStats(). This is only called once per
+  // registration, and only if the statistics are enabled.
+  virtual std::string Name() const { return "UnnamedPropagator"; }
+};
+
+// Statistics on the calls to all the propagators with a given name, see
+// SatParameters.propagator_stats_sampling_period.
+struct PropagatorStats {
+  std::string name;
+  int64_t num_calls = 0;
+  int64_t num_calls_without_push = 0;
+  int64_t num_conflicts = 0;
+  int64_t num_integer_pushes = 0;
+  int64_t num_literal_pushes = 0;
+  int64_t num_reason_elements = 0;
+  int64_t num_conflict_literals = 0;
+
+  // Only one call out of the sampling period is timed.
+  int64_t num_timed_calls = 0;
+  int64_t timed_nanos = 0;
+
+  // Adds the counters of other, which should have the same name.
+  void MergeFrom(const PropagatorStats& other) {
+    num_calls += other.num_calls;
+    num_calls_without_push += other.num_calls_without_push;
+    num_conflicts += other.num_conflicts;
+    num_integer_pushes += other.num_integer_pushes;
+    num_literal_pushes += other.num_literal_pushes;
+    num_reason_elements += other.num_reason_elements;
+    num_conflict_literals += other.num_conflict_literals;
+    num_timed_calls += other.num_timed_calls;
+    timed_nanos += other.timed_nanos;
+  }
+
+  double TimedSeconds() const { return 1e-9 * timed_nanos; }
+  double EstimatedSeconds() const {
+    if (num_timed_calls == 0) return 0.0;
+    return TimedSeconds() * static_cast<double>(num_calls) /
+           static_cast<double>(num_timed_calls);
+  }
 };
 
 // Singleton for basic reversible types. We need the wrapper so that they can be
@@ -1212,6 +1260,15 @@ class GenericLiteralWatcher final : public SatPropagator {
   // Returns the number of registered propagators.
   int NumPropagators() const { return in_queue_.size(); }
 
+  // Collects the statistics of the propagators, aggregated by name, and times
+  // one call out of sampling_period of each of them. This is called at
+  // construction if the parameter propagator_stats_sampling_period is positive.
+  // When disabled, this only costs one well predicted branch per call.
+  void EnablePropagatorStats(int sampling_period);
+
+  // Returns the statistics collected so far, by decreasing estimated time.
+  std::vector<PropagatorStats> GetPropagatorStats() const;
+
   // Set a callback for new variable bounds at level 0.
   //
   // This will be called (only at level zero) with the list of IntegerVariable
@@ -1255,6 +1312,18 @@ class GenericLiteralWatcher final : public SatPropagator {
   // called.
   void UpdateCallingNeeds(Trail* trail);
 
+  bool CallPropagator(int id) {
+    // TODO(user): Maybe just provide one function Propagate(watch_indices) ?
+    return id_to_watch_indices_[id].empty()
+               ? watchers_[id]->Propagate()
+               : watchers_[id]->IncrementalPropagate(id_to_watch_indices_[id]);
+  }
+
+  // Same as CallPropagator() but updates the statistics of the propagator.
+  // This is out of line to keep the propagation loop small.
+  ABSL_ATTRIBUTE_NOINLINE bool CallPropagatorAndCollectStats(
+      int id, const Trail& trail);
+
   TimeLimit* time_limit_;
   IntegerTrail* integer_trail_;
   RevIntRepository* rev_int_repository_;
@@ -1306,6 +1375,14 @@ class GenericLiteralWatcher final : public SatPropagator {
   std::function<bool()> stop_propagation_callback_;
 
   std::vector<bool*> bool_to_reset_on_backtrack_;
+
+  // For EnablePropagatorStats(). The index of the statistics of a propagator
+  // is computed on its first call, it is -1 before.
+  bool collect_propagator_stats_ = false;
+  int propagator_stats_sampling_period_ = 1;
+  std::vector<int> id_to_stats_index_;
+  std::vector<PropagatorStats> propagator_stats_;
+  absl::flat_hash_map<std::string, int> name_to_stats_index_;
 };
 
 // ============================================================================
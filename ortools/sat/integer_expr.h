@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -82,6 +83,7 @@ class LinearConstraintPropagator : public PropagatorInterface,
   // enforcement_literals.
   LinearConstraintPropagator(LinearConstraint ct, Model* model);
 
+  std::string Name() const final { return "LinearConstraintPropagator"; }
   // We propagate:
   // - If the sum of the individual lower-bound is > upper_bound, we fail.
   // - For all i, upper-bound of i
@@ -227,6 +229,7 @@ class MinPropagator : public PropagatorInterface {
   MinPropagator(const MinPropagator&) = delete;
   MinPropagator& operator=(const MinPropagator&) = delete;
 
+  std::string Name() const final { return "MinPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -248,6 +251,7 @@ class LinMinPropagator : public PropagatorInterface, LazyReasonInterface {
   LinMinPropagator(const LinMinPropagator&) = delete;
   LinMinPropagator& operator=(const LinMinPropagator&) = delete;
 
+  std::string Name() const final { return "LinMinPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -290,6 +294,7 @@ class ProductPropagator : public PropagatorInterface {
   ProductPropagator(const ProductPropagator&) = delete;
   ProductPropagator& operator=(const ProductPropagator&) = delete;
 
+  std::string Name() const final { return "ProductPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -327,6 +332,7 @@ class DivisionPropagator : public PropagatorInterface {
   DivisionPropagator(const DivisionPropagator&) = delete;
   DivisionPropagator& operator=(const DivisionPropagator&) = delete;
 
+  std::string Name() const final { return "DivisionPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -367,6 +373,7 @@ class FixedDivisionPropagator : public PropagatorInterface {
   FixedDivisionPropagator(const FixedDivisionPropagator&) = delete;
   FixedDivisionPropagator& operator=(const FixedDivisionPropagator&) = delete;
 
+  std::string Name() const final { return "FixedDivisionPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -389,6 +396,7 @@ class FixedModuloPropagator : public PropagatorInterface {
   FixedModuloPropagator(const FixedModuloPropagator&) = delete;
   FixedModuloPropagator& operator=(const FixedModuloPropagator&) = delete;
 
+  std::string Name() const final { return "FixedModuloPropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
@@ -417,6 +425,7 @@ class SquarePropagator : public PropagatorInterface {
   SquarePropagator(const SquarePropagator&) = delete;
   SquarePropagator& operator=(const SquarePropagator&) = delete;
 
+  std::string Name() const final { return "SquarePropagator"; }
   bool Propagate() final;
   void RegisterWith(GenericLiteralWatcher* watcher);
 
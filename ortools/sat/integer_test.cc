@@ -16,6 +16,7 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -546,6 +547,61 @@ TEST(GenericLiteralWatcherTest, RevIsInDiveUpdate) {
   EXPECT_TRUE(is_in_dive);
 }
 
+// Pushes lb(a) >= lb(b).
+class CopyLowerBoundPropagator : public PropagatorInterface {
+ public:
+  CopyLowerBoundPropagator(IntegerVariable a, IntegerVariable b, Model* model)
+      : a_(a), b_(b), integer_trail_(model->GetOrCreate<IntegerTrail>()) {}
+
+  std::string Name() const final { return "CopyLowerBound"; }
+  bool Propagate() final {
+    const IntegerValue lb = integer_trail_->LowerBound(b_);
+    if (integer_trail_->LowerBound(a_) >= lb) return true;
+    return integer_trail_->Enqueue(IntegerLiteral::GreaterOrEqual(a_, lb), {},
+                                   {IntegerLiteral::GreaterOrEqual(b_, lb)});
+  }
+
+ private:
+  const IntegerVariable a_;
+  const IntegerVariable b_;
+  IntegerTrail* integer_trail_;
+};
+
+TEST(GenericLiteralWatcherTest, PropagatorStats) {
+  Model model;
+  auto* sat_solver = model.GetOrCreate<SatSolver>();
+  auto* integer_trail = model.GetOrCreate<IntegerTrail>();
+  auto* watcher = model.GetOrCreate<GenericLiteralWatcher>();
+  watcher->EnablePropagatorStats(/*sampling_period=*/1);
+  const IntegerVariable a = model.Add(NewIntegerVariable(0, 5));
+  const IntegerVariable b = model.Add(NewIntegerVariable(0, 10));
+
+  auto* propagator = new CopyLowerBoundPropagator(a, b, &model);
+  model.TakeOwnership(propagator);
+  watcher->WatchLowerBound(b, watcher->Register(propagator));
+  EXPECT_TRUE(watcher->GetPropagatorStats().empty());
+
+  // The first call does not push anything.
+  EXPECT_TRUE(sat_solver->Propagate());
+  EXPECT_TRUE(integer_trail->Enqueue(
+      IntegerLiteral::GreaterOrEqual(b, IntegerValue(3)), {}, {}));
+  EXPECT_TRUE(sat_solver->Propagate());
+  EXPECT_EQ(integer_trail->LowerBound(a), 3);
+  EXPECT_TRUE(integer_trail->Enqueue(
+      IntegerLiteral::GreaterOrEqual(b, IntegerValue(7)), {}, {}));
+  EXPECT_FALSE(sat_solver->Propagate());
+
+  const std::vector<PropagatorStats> stats = watcher->GetPropagatorStats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].name, "CopyLowerBound");
+  EXPECT_EQ(stats[0].num_calls, 3);
+  EXPECT_EQ(stats[0].num_calls_without_push, 1);
+  EXPECT_EQ(stats[0].num_conflicts, 1);
+  EXPECT_EQ(stats[0].num_integer_pushes, 1);
+  EXPECT_EQ(stats[0].num_literal_pushes, 0);
+  EXPECT_EQ(stats[0].num_timed_calls, 3);
+}
+
 TEST(IntegerEncoderTest, BasicInequalityEncoding) {
   Model model;
   IntegerEncoder* encoder = model.GetOrCreate<IntegerEncoder>();
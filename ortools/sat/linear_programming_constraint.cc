@@ -38,6 +38,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "ortools/algorithms/binary_search.h"
+#include "ortools/base/hash.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/mathutil.h"
 #include "ortools/base/strong_vector.h"
@@ -50,6 +51,7 @@
 #include "ortools/lp_data/scattered_vector.h"
 #include "ortools/lp_data/sparse.h"
 #include "ortools/sat/cp_model_mapping.h"
+#include "ortools/sat/cp_model_utils.h"
 #include "ortools/sat/cuts.h"
 #include "ortools/sat/implied_bounds.h"
 #include "ortools/sat/integer.h"
@@ -291,6 +293,8 @@ LinearProgrammingConstraint::LinearProgrammingConstraint(
       objective_definition_(model->GetOrCreate<ObjectiveDefinition>()),
       shared_stats_(model->GetOrCreate<SharedStatistics>()),
       shared_response_manager_(model->GetOrCreate<SharedResponseManager>()),
+      shared_lp_bases_(model->Mutable<SharedLPBasisRepository>()),
+      shared_cuts_(model->Mutable<SharedCutPool>()),
       random_(model->GetOrCreate<ModelRandomGenerator>()),
       symmetrizer_(model->GetOrCreate<LinearConstraintSymmetrizer>()),
       linear_propagator_(model->GetOrCreate<LinearPropagator>()),
@@ -592,6 +596,8 @@ bool LinearProgrammingConstraint::CreateLpFromConstraintManager() {
     }
   }
 
+  if (shared_lp_bases_ != nullptr) lp_fingerprint_ = ComputeLpFingerprint();
+
   VLOG(3) << "LP relaxation: " << integer_lp_.size() << " x "
           << integer_variables_.size() << ". "
           << constraint_manager_.AllConstraints().size()
@@ -599,6 +605,27 @@ bool LinearProgrammingConstraint::CreateLpFromConstraintManager() {
   return true;
 }
 
+uint64_t LinearProgrammingConstraint::ComputeLpFingerprint() const {
+  uint64_t fingerprint = kDefaultFingerprintSeed;
+  fingerprint = FingerprintSingleField(integer_variables_.size(), fingerprint);
+  for (const LinearConstraintInternal& ct : integer_lp_) {
+    fingerprint = FingerprintSingleField(ct.num_terms, fingerprint);
+  }
+  if (!integer_lp_cols_.empty()) {
+    fingerprint = fasthash64(integer_lp_cols_.data(),
+                             integer_lp_cols_.size() * sizeof(glop::ColIndex),
+                             fingerprint);
+    fingerprint = fasthash64(integer_lp_coeffs_.data(),
+                             integer_lp_coeffs_.size() * sizeof(IntegerValue),
+                             fingerprint);
+  }
+  for (const auto& [col, coeff] : integer_objective_) {
+    fingerprint = FingerprintSingleField(col, fingerprint);
+    fingerprint = FingerprintSingleField(coeff, fingerprint);
+  }
+  return fingerprint;
+}
+
 // TODO(user): This is a duplicate of glop scaling code, but it allows to
 // work directly on our representation...
 void LinearProgrammingConstraint::ComputeIntegerLpScalingFactors() {
@@ -932,6 +959,21 @@ bool LinearProgrammingConstraint::SolveLp() {
     lp_at_level_zero_is_final_ = false;
   }
 
+  // If another worker already solved this exact LP, we start from its optimal
+  // basis rather than from our own basis, which is for a different LP.
+  int64_t shared_basis_num_iterations = -1;
+  if (level == 0 && shared_lp_bases_ != nullptr &&
+      lp_fingerprint_ != state_lp_fingerprint_) {
+    glop::BasisState shared_basis;
+    if (shared_lp_bases_->GetBasis(lp_fingerprint_, &shared_basis,
+                                   &shared_basis_num_iterations)) {
+      ++num_shared_basis_loads_;
+      LoadBasisState(shared_basis);
+    } else {
+      shared_basis_num_iterations = -1;
+    }
+  }
+
   const double unscaling_factor = 1.0 / scaler_.ObjectiveScalingFactor();
   const double offset_before_unscaling =
       ToDouble(integer_objective_offset_) * scaler_.ObjectiveScalingFactor();
@@ -948,7 +990,19 @@ bool LinearProgrammingConstraint::SolveLp() {
   }
 
   state_ = simplex_.GetState();
+  state_lp_fingerprint_ = lp_fingerprint_;
   total_num_simplex_iterations_ += simplex_.GetNumberOfIterations();
+  if (level == 0 && shared_lp_bases_ != nullptr && status.ok() &&
+      simplex_.GetProblemStatus() == glop::ProblemStatus::OPTIMAL) {
+    if (shared_basis_num_iterations >= 0) {
+      num_iterations_saved_by_shared_basis_ +=
+          std::max<int64_t>(0, shared_basis_num_iterations -
+                                   simplex_.GetNumberOfIterations());
+    } else {
+      shared_lp_bases_->AddBasis(lp_fingerprint_, state_,
+                                 simplex_.GetNumberOfIterations());
+    }
+  }
   if (!status.ok()) {
     VLOG(2) << "The LP solver encountered an error: " << status.error_message();
     simplex_.ClearStateForNextSolve();
@@ -2212,6 +2266,10 @@ bool LinearProgrammingConstraint::Propagate() {
           return integer_trail_->ReportConflict({});
         }
         top_n_cuts_.TransferToManager(&constraint_manager_);
+        if (shared_cuts_ != nullptr) {
+          ExportTightCutsToSharedPool();
+          ImportCutsFromSharedPool();
+        }
       }
 
       // Try to add cuts.
@@ -2262,6 +2320,77 @@ bool LinearProgrammingConstraint::Propagate() {
   return true;
 }
 
+void LinearProgrammingConstraint::ExportTightCutsToSharedPool() {
+  const auto* mapping = model_->Get<CpModelMapping>();
+  if (mapping == nullptr) return;
+  const auto& all_constraints = constraint_manager_.AllConstraints();
+  const auto& lp_constraints = constraint_manager_.LpConstraints();
+  if (simplex_.GetProblemNumRows() != RowIndex(lp_constraints.size())) return;
+  for (int i = 0; i < lp_constraints.size(); ++i) {
+    const auto& info = all_constraints[lp_constraints[i]];
+    if (!info.is_deletable) continue;
+    if (std::abs(simplex_.GetDualValue(RowIndex(i))) < kZeroTolerance) {
+      continue;
+    }
+    if (!exported_cut_hashes_.insert(info.hash).second) continue;
+
+    // We can only share the cuts on variables of the proto. The other ones,
+    // like the objective or the orbit sums, are local to this worker.
+    const LinearConstraint& ct = info.constraint;
+    std::vector<std::pair<int, int64_t>> terms;
+    for (int j = 0; j < ct.num_terms; ++j) {
+      const IntegerVariable var = ct.vars[j];
+      const int proto_var =
+          mapping->GetProtoVariableFromIntegerVariable(PositiveVariable(var));
+      if (proto_var == -1) break;
+      const IntegerValue coeff =
+          VariableIsPositive(var) ? ct.coeffs[j] : -ct.coeffs[j];
+      terms.push_back({proto_var, coeff.value()});
+    }
+    if (static_cast<int>(terms.size()) != ct.num_terms) continue;
+
+    std::sort(terms.begin(), terms.end());
+    SharedCutPool::Cut cut;
+    for (const auto& [proto_var, coeff] : terms) {
+      cut.vars.push_back(proto_var);
+      cut.coeffs.push_back(coeff);
+    }
+    cut.lb = ct.lb.value();
+    cut.ub = ct.ub.value();
+    if (shared_cuts_->AddCut(std::move(cut))) ++num_exported_cuts_;
+  }
+}
+
+void LinearProgrammingConstraint::ImportCutsFromSharedPool() {
+  const auto* mapping = model_->Get<CpModelMapping>();
+  if (mapping == nullptr) return;
+  tmp_shared_cuts_.clear();
+  shared_cuts_->GetNewCuts(&num_seen_shared_cuts_, &tmp_shared_cuts_);
+  for (const SharedCutPool::Cut& cut : tmp_shared_cuts_) {
+    LinearConstraintBuilder builder(IntegerValue(cut.lb), IntegerValue(cut.ub));
+    bool all_vars_in_lp = true;
+    for (int i = 0; i < cut.vars.size(); ++i) {
+      const int proto_var = cut.vars[i];
+      if (proto_var >= mapping->NumProtoVariables() ||
+          !mapping->IsInteger(proto_var)) {
+        all_vars_in_lp = false;
+        break;
+      }
+      const IntegerVariable var = mapping->Integer(proto_var);
+      const auto it = dispatcher_->find(var);
+      if (it == dispatcher_->end() || it->second != this) {
+        all_vars_in_lp = false;
+        break;
+      }
+      builder.AddTerm(var, IntegerValue(cut.coeffs[i]));
+    }
+    if (!all_vars_in_lp) continue;
+
+    // Our own cuts are filtered here too since they are not violated anymore.
+    constraint_manager_.AddCut(builder.Build(), "Shared");
+  }
+}
+
 absl::int128 LinearProgrammingConstraint::GetImpliedLowerBound(
     const LinearConstraint& terms) const {
   absl::int128 lower_bound(0);
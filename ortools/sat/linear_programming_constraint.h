@@ -14,6 +14,7 @@
 #ifndef OR_TOOLS_SAT_LINEAR_PROGRAMMING_CONSTRAINT_H_
 #define OR_TOOLS_SAT_LINEAR_PROGRAMMING_CONSTRAINT_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -23,6 +24,7 @@
 #include <vector>
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "absl/numeric/int128.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
@@ -186,6 +188,7 @@ class LinearProgrammingConstraint : public PropagatorInterface,
   double ObjectiveLpLowerBound() const { return lp_objective_lower_bound_; }
 
   // PropagatorInterface API.
+  std::string Name() const override { return "LinearProgrammingConstraint"; }
   bool Propagate() override;
   bool IncrementalPropagate(const std::vector<int>& watch_indices) override;
   void RegisterWith(Model* model);
@@ -234,6 +237,18 @@ class LinearProgrammingConstraint : public PropagatorInterface,
   // This can serve as a timestamp to know if a saved basis is out of date.
   int64_t num_lp_changes() const { return num_lp_changes_; }
 
+  // Stats on the level zero solves that were warm-started from a basis of the
+  // SharedLPBasisRepository, and the simplex iterations this saved compared to
+  // the solve that found this basis.
+  int64_t num_shared_basis_loads() const { return num_shared_basis_loads_; }
+  int64_t num_iterations_saved_by_shared_basis() const {
+    return num_iterations_saved_by_shared_basis_;
+  }
+
+  // Number of cuts of this LP that were added to the SharedCutPool. The
+  // imported ones are counted under the "Shared" cut type.
+  int64_t num_exported_cuts() const { return num_exported_cuts_; }
+
   const std::vector<int64_t>& num_solves_by_status() const {
     return num_solves_by_status_;
   }
@@ -268,6 +283,18 @@ class LinearProgrammingConstraint : public PropagatorInterface,
   }
 
  private:
+  // Returns a fingerprint of the current LP matrix and objective. The bounds
+  // are not included, an optimal basis for other bounds is still a good start.
+  uint64_t ComputeLpFingerprint() const;
+
+  // Exchanges cuts with the other workers through the SharedCutPool. Export
+  // adds the cuts of the current LP that have a non-zero dual value, so this
+  // must be called just after an optimal solve of the current LP. Import adds
+  // the new cuts of the pool to the constraint manager, if they are violated.
+  // These must only be called at level zero.
+  void ExportTightCutsToSharedPool();
+  void ImportCutsFromSharedPool();
+
   // Helper method to fill reduced cost / dual ray reason in 'integer_reason'.
   // Generates a set of IntegerLiterals explaining why the best solution can not
   // be improved using reduced costs. This is used to generate explanations for
@@ -545,6 +572,8 @@ class LinearProgrammingConstraint : public PropagatorInterface,
   ObjectiveDefinition* objective_definition_;
   SharedStatistics* shared_stats_;
   SharedResponseManager* shared_response_manager_;
+  SharedLPBasisRepository* shared_lp_bases_;
+  SharedCutPool* shared_cuts_;
   ModelRandomGenerator* random_;
   LinearConstraintSymmetrizer* symmetrizer_;
   LinearPropagator* linear_propagator_;
@@ -640,6 +669,20 @@ class LinearProgrammingConstraint : public PropagatorInterface,
   // The number of times we changed the LP.
   int64_t num_lp_changes_ = 0;
 
+  // Only computed if shared_lp_bases_ is not nullptr. The second one is the
+  // fingerprint of the LP for which state_ was last computed.
+  uint64_t lp_fingerprint_ = 0;
+  uint64_t state_lp_fingerprint_ = 0;
+  int64_t num_shared_basis_loads_ = 0;
+  int64_t num_iterations_saved_by_shared_basis_ = 0;
+
+  // Only used if shared_cuts_ is not nullptr. We remember the hash of the
+  // exported cuts so that we only export them once.
+  int num_seen_shared_cuts_ = 0;
+  int64_t num_exported_cuts_ = 0;
+  absl::flat_hash_set<size_t> exported_cut_hashes_;
+  std::vector<SharedCutPool::Cut> tmp_shared_cuts_;
+
   // Some stats on the LP statuses encountered.
   int64_t num_solves_ = 0;
   mutable int64_t num_adjusts_ = 0;
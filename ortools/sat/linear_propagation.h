@@ -335,6 +335,7 @@ class LinearPropagator : public PropagatorInterface,
  public:
   explicit LinearPropagator(Model* model);
   ~LinearPropagator() override;
+  std::string Name() const final { return "LinearPropagator"; }
   bool Propagate() final;
   void SetLevel(int level) final;
 
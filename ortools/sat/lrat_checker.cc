@@ -0,0 +1,303 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/lrat_checker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>  // NOLINT
+#include <string>
+#include <vector>
+
+#include "absl/log/check.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/span.h"
+#include "ortools/base/logging.h"
+#include "ortools/base/threadpool.h"
+#include "ortools/sat/sat_base.h"
+
+namespace operations_research {
+namespace sat {
+
+void LratChecker::AddProblemClause(ClauseId id,
+                                   absl::Span<const Literal> clause) {
+  if (id <= ClauseId(0) || id_to_index_.contains(id) ||
+      (first_infered_clause_index_ != -1 && id <= last_id_)) {
+    LOG(WARNING) << "Invalid or duplicate problem clause id " << id;
+    has_error_ = true;
+    return;
+  }
+  last_id_ = std::max(last_id_, id);
+  id_to_index_[id] = clauses_.size();
+  Clause& new_clause = clauses_.emplace_back();
+  new_clause.first_literal_index = literals_.size();
+  new_clause.num_literals = clause.size();
+  new_clause.first_hint_index = hints_.size();
+  new_clause.num_hints = 0;
+  new_clause.is_problem_clause = true;
+  for (const Literal literal : clause) {
+    literals_.push_back(literal);
+    num_variables_ = std::max(num_variables_, literal.Variable().value() + 1);
+  }
+  if (clause.empty()) has_empty_clause_ = true;
+}
+
+void LratChecker::AddInferedClause(ClauseId id,
+                                   absl::Span<const Literal> clause,
+                                   absl::Span<const ClauseId> rup_hints) {
+  if (id <= last_id_) {
+    LOG(WARNING) << "Infered clause ids must be strictly increasing: " << id;
+    has_error_ = true;
+    return;
+  }
+  if (first_infered_clause_index_ == -1) {
+    first_infered_clause_index_ = clauses_.size();
+  }
+  last_id_ = id;
+  id_to_index_[id] = clauses_.size();
+  Clause& new_clause = clauses_.emplace_back();
+  new_clause.first_literal_index = literals_.size();
+  new_clause.num_literals = clause.size();
+  new_clause.first_hint_index = hints_.size();
+  new_clause.num_hints = rup_hints.size();
+  for (const Literal literal : clause) {
+    literals_.push_back(literal);
+    num_variables_ = std::max(num_variables_, literal.Variable().value() + 1);
+  }
+  // We resolve the hints right away since this is the only time at which we
+  // know that they refer to clauses added before this one.
+  for (const ClauseId hint : rup_hints) {
+    hints_.push_back(IndexOf(hint));
+  }
+  if (clause.empty()) has_empty_clause_ = true;
+}
+
+void LratChecker::DeleteClauses(absl::Span<const ClauseId> ids) {
+  for (const ClauseId id : ids) {
+    const int index = IndexOf(id);
+    if (index == -1) {
+      LOG(WARNING) << "Couldn't find deleted clause " << id;
+      continue;
+    }
+    Clause& clause = clauses_[index];
+    clause.deleted_index = std::min<int>(clause.deleted_index, clauses_.size());
+  }
+}
+
+int LratChecker::IndexOf(ClauseId id) const {
+  const auto it = id_to_index_.find(id);
+  return it == id_to_index_.end() ? -1 : it->second;
+}
+
+LratChecker::Status LratChecker::Check(double max_time_in_seconds,
+                                       int num_threads) {
+  CHECK_GT(num_threads, 0);
+  if (has_error_ || !has_empty_clause_) return Status::INVALID;
+  if (first_infered_clause_index_ == -1) return Status::INVALID;
+
+  const int64_t start_time_nanos = absl::GetCurrentTimeNanos();
+  const absl::Time deadline =
+      absl::Now() + absl::Seconds(std::min(max_time_in_seconds, 1e9));
+  const int num_steps = clauses_.size() - first_infered_clause_index_;
+  num_threads = std::max(1, std::min(num_threads, num_steps));
+
+  // Each step only depends on the clauses it refers to, so we can check
+  // contiguous chunks of the proof independently.
+  std::atomic<bool> is_invalid = false;
+  std::atomic<bool> timed_out = false;
+  const auto check_chunk = [&](int begin, int end) {
+    VariablesAssignment assignment(num_variables_);
+    std::vector<Literal> assigned;
+    for (int i = begin; i < end; ++i) {
+      if (is_invalid.load(std::memory_order_relaxed)) return;
+      if ((i - begin) % 1000 == 0 && absl::Now() > deadline) {
+        timed_out = true;
+        return;
+      }
+      if (!CheckStep(i, &assignment, &assigned)) {
+        is_invalid = true;
+        return;
+      }
+    }
+  };
+  if (num_threads == 1) {
+    check_chunk(first_infered_clause_index_, clauses_.size());
+  } else {
+    ThreadPool pool(num_threads);
+    pool.StartWorkers();
+    for (int t = 0; t < num_threads; ++t) {
+      const int begin = first_infered_clause_index_ +
+                        static_cast<int64_t>(num_steps) * t / num_threads;
+      const int end = first_infered_clause_index_ +
+                      static_cast<int64_t>(num_steps) * (t + 1) / num_threads;
+      pool.Schedule([begin, end, &check_chunk]() { check_chunk(begin, end); });
+    }
+  }
+
+  if (is_invalid) return Status::INVALID;
+  if (timed_out) return Status::UNKNOWN;
+  num_checked_steps_ = num_steps;
+  check_time_in_seconds_ =
+      1e-9 * (absl::GetCurrentTimeNanos() - start_time_nanos);
+  return Status::VALID;
+}
+
+bool LratChecker::CheckStep(int clause_index, VariablesAssignment* assignment,
+                            std::vector<Literal>* assigned) const {
+  const Clause& clause = clauses_[clause_index];
+  if (clause.is_problem_clause) return true;
+  const auto unassign_all = [&]() {
+    for (const Literal literal : *assigned) {
+      assignment->UnassignLiteral(literal);
+    }
+    assigned->clear();
+  };
+
+  // Falsify all the literals of the clause. A tautology is trivially valid.
+  for (const Literal literal : Literals(clause)) {
+    if (assignment->LiteralIsTrue(literal)) {
+      unassign_all();
+      return true;
+    }
+    if (assignment->LiteralIsFalse(literal)) continue;
+    assignment->AssignFromTrueLiteral(literal.Negated());
+    assigned->push_back(literal.Negated());
+  }
+
+  // Each hint must be unit, except the last one which must be conflicting.
+  bool has_conflict = false;
+  for (const int hint_index : Hints(clause)) {
+    if (hint_index < 0 || hint_index >= clause_index ||
+        clauses_[hint_index].deleted_index <= clause_index) {
+      break;
+    }
+    LiteralIndex unit_literal = kNoLiteralIndex;
+    bool is_valid_hint = true;
+    for (const Literal literal : Literals(clauses_[hint_index])) {
+      if (assignment->LiteralIsFalse(literal)) continue;
+      if (assignment->LiteralIsTrue(literal) ||
+          unit_literal != kNoLiteralIndex) {
+        is_valid_hint = false;
+        break;
+      }
+      unit_literal = literal.Index();
+    }
+    if (!is_valid_hint) break;
+    if (unit_literal == kNoLiteralIndex) {
+      has_conflict = true;
+      break;
+    }
+    assignment->AssignFromTrueLiteral(Literal(unit_literal));
+    assigned->push_back(Literal(unit_literal));
+  }
+  unassign_all();
+  return has_conflict;
+}
+
+namespace {
+
+// Parses the given words as a list of integers ending with 0, starting at index
+// 'start'. Returns the index after the final 0, or -1 in case of error.
+int ParseZeroTerminatedList(absl::Span<const absl::string_view> words,
+                            int start, std::vector<int64_t>* values) {
+  values->clear();
+  for (int i = start; i < words.size(); ++i) {
+    int64_t value;
+    if (!absl::SimpleAtoi(words[i], &value)) return -1;
+    if (value == 0) return i + 1;
+    values->push_back(value);
+  }
+  return -1;
+}
+
+}  // namespace
+
+bool AddProblemClauses(const std::string& file_path,
+                       LratChecker* lrat_checker) {
+  int line_number = 0;
+  int64_t clause_id = 0;
+  std::vector<int64_t> values;
+  std::vector<Literal> literals;
+  std::ifstream file(file_path);
+  std::string line;
+  while (std::getline(file, line)) {
+    line_number++;
+    const std::vector<absl::string_view> words =
+        absl::StrSplit(line, absl::ByAnyChar(" \t"), absl::SkipWhitespace());
+    if (words.empty() || words[0] == "c" || words[0] == "p") continue;
+    if (ParseZeroTerminatedList(words, 0, &values) != words.size()) {
+      LOG(ERROR) << "Invalid content '" << line << "' at line " << line_number
+                 << " of " << file_path;
+      return false;
+    }
+    literals.clear();
+    for (const int64_t value : values) {
+      literals.push_back(Literal(static_cast<int>(value)));
+    }
+    lrat_checker->AddProblemClause(ClauseId(++clause_id), literals);
+  }
+  return true;
+}
+
+bool AddInferedAndDeletedClauses(const std::string& file_path,
+                                 LratChecker* lrat_checker) {
+  int line_number = 0;
+  std::vector<int64_t> values;
+  std::vector<Literal> literals;
+  std::vector<ClauseId> ids;
+  std::ifstream file(file_path);
+  std::string line;
+  while (std::getline(file, line)) {
+    line_number++;
+    const std::vector<absl::string_view> words =
+        absl::StrSplit(line, absl::ByAnyChar(" \t"), absl::SkipWhitespace());
+    if (words.empty() || words[0] == "c") continue;
+
+    // Each line is either "<id> <literals> 0 <hints> 0" or "<id> d <ids> 0".
+    int64_t id;
+    bool valid = words.size() >= 2 && absl::SimpleAtoi(words[0], &id);
+    if (valid && words[1] == "d") {
+      valid = ParseZeroTerminatedList(words, 2, &values) == words.size();
+      ids.clear();
+      for (const int64_t value : values) ids.push_back(ClauseId(value));
+      if (valid) lrat_checker->DeleteClauses(ids);
+    } else if (valid) {
+      const int hints_start = ParseZeroTerminatedList(words, 1, &values);
+      literals.clear();
+      for (const int64_t value : values) {
+        literals.push_back(Literal(static_cast<int>(value)));
+      }
+      valid = hints_start != -1 &&
+              ParseZeroTerminatedList(words, hints_start, &values) ==
+                  words.size();
+      ids.clear();
+      for (const int64_t value : values) ids.push_back(ClauseId(value));
+      if (valid) lrat_checker->AddInferedClause(ClauseId(id), literals, ids);
+    }
+    if (!valid) {
+      LOG(ERROR) << "Invalid content '" << line << "' at line " << line_number
+                 << " of " << file_path;
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace sat
+}  // namespace operations_research
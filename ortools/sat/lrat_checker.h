@@ -0,0 +1,166 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_LRAT_CHECKER_H_
+#define OR_TOOLS_SAT_LRAT_CHECKER_H_
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+#include "ortools/sat/sat_base.h"
+#include "ortools/util/strong_integers.h"
+
+namespace operations_research {
+namespace sat {
+
+// The unique identifier of a clause in an LRAT proof (> 0).
+DEFINE_STRONG_INT64_TYPE(ClauseId);
+
+// LRAT is a SAT proof format derived from DRAT, where each infered clause is
+// followed by the ids of the clauses ("hints") which, in this order, become
+// unit and then conflicting by unit propagation once all the literals of the
+// infered clause are false. See "Efficient Certified RAT Verification",
+// Cruz-Filipe et al., CADE 2017.
+//
+// Contrary to DRAT, checking such a proof does not require any search for the
+// clauses to propagate, and each step can be checked independently of the
+// others. This class thus checks an LRAT proof in time linear in its size, and
+// can use several threads to do so.
+//
+// Note that only RUP steps (i.e. without RAT hints) are currently supported.
+class LratChecker {
+ public:
+  LratChecker() = default;
+
+  // This type is neither copyable nor movable.
+  LratChecker(const LratChecker&) = delete;
+  LratChecker& operator=(const LratChecker&) = delete;
+
+  // Returns the number of Boolean variables used in the problem and infered
+  // clauses.
+  int num_variables() const { return num_variables_; }
+
+  // Adds a clause of the problem that must be checked, with the given id. The
+  // problem clauses are usually added first, but they can also be added between
+  // infered clauses, in which case their ids must follow the same strictly
+  // increasing order. Must not be called after Check().
+  void AddProblemClause(ClauseId id, absl::Span<const Literal> clause);
+
+  // Adds a clause which is infered from the non-deleted problem and infered
+  // clauses with the given ids. The ids of the infered clauses must be strictly
+  // increasing, and larger than the ones of the problem clauses. Must not be
+  // called after Check().
+  void AddInferedClause(ClauseId id, absl::Span<const Literal> clause,
+                        absl::Span<const ClauseId> rup_hints);
+
+  // Deletes problem or infered clauses. They cannot be used as hints in the
+  // clauses infered afterwards. Must not be called after Check().
+  void DeleteClauses(absl::Span<const ClauseId> ids);
+
+  // Checks that each infered clause can be derived by unit propagation of its
+  // hints, and that the empty clause was infered. Returns VALID if this is the
+  // case, INVALID if it is not, and UNKNOWN if the check timed out. The steps
+  // are split in contiguous chunks checked in parallel by 'num_threads'
+  // threads.
+  enum Status {
+    UNKNOWN,
+    VALID,
+    INVALID,
+  };
+  Status Check(double max_time_in_seconds, int num_threads = 1);
+
+  // Statistics about the last successful Check() call.
+  int64_t num_checked_steps() const { return num_checked_steps_; }
+  double check_time_in_seconds() const { return check_time_in_seconds_; }
+
+ private:
+  // A problem or infered clause. Its literals and hints are the subranges of
+  // 'literals_' and 'hints_' starting at the given indices.
+  struct Clause {
+    int64_t first_literal_index;
+    int num_literals;
+    int64_t first_hint_index;
+    int num_hints;
+    bool is_problem_clause = false;
+
+    // The index in 'clauses_' from which this clause is deleted (inclusive),
+    // i.e. it can only be used as a hint by the infered clauses with a lower
+    // index.
+    int deleted_index = std::numeric_limits<int>::max();
+  };
+
+  // Returns true if the infered clause with the given index is derived by unit
+  // propagation of its hints. 'assignment' must be fully unassigned, and is
+  // still fully unassigned upon return.
+  bool CheckStep(int clause_index, VariablesAssignment* assignment,
+                 std::vector<Literal>* assigned) const;
+
+  // Returns the index in 'clauses_' of the clause with the given id, or -1 if
+  // there is no such clause.
+  int IndexOf(ClauseId id) const;
+
+  absl::Span<const Literal> Literals(const Clause& clause) const {
+    return absl::MakeConstSpan(literals_).subspan(clause.first_literal_index,
+                                                  clause.num_literals);
+  }
+
+  absl::Span<const int> Hints(const Clause& clause) const {
+    return absl::MakeConstSpan(hints_).subspan(clause.first_hint_index,
+                                               clause.num_hints);
+  }
+
+  // The problem clauses, followed by the infered clauses.
+  std::vector<Clause> clauses_;
+  absl::flat_hash_map<ClauseId, int> id_to_index_;
+
+  // The index of the first infered clause in 'clauses_', or -1 if there is no
+  // infered clause yet.
+  int first_infered_clause_index_ = -1;
+  ClauseId last_id_ = ClauseId(0);
+
+  // All the literals of 'clauses_', and the hints of the infered clauses, as
+  // indices in 'clauses_' (or -1 if the hint id is unknown).
+  std::vector<Literal> literals_;
+  std::vector<int> hints_;
+
+  // Whether an error was detected while adding the clauses, for instance
+  // non-increasing ids.
+  bool has_error_ = false;
+  bool has_empty_clause_ = false;
+
+  int num_variables_ = 0;
+
+  int64_t num_checked_steps_ = 0;
+  double check_time_in_seconds_ = 0.0;
+};
+
+// Adds to the given LRAT checker the problem clauses from the file at the given
+// path, which must be in DIMACS format. The clauses are numbered from 1 in the
+// order of the file. Returns true iff the file was successfully parsed.
+bool AddProblemClauses(const std::string& file_path,
+                       LratChecker* lrat_checker);
+
+// Adds to the given LRAT checker the infered and deleted clauses from the file
+// at the given path, which must be in the textual LRAT format. Returns true iff
+// the file was successfully parsed.
+bool AddInferedAndDeletedClauses(const std::string& file_path,
+                                 LratChecker* lrat_checker);
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_LRAT_CHECKER_H_
@@ -0,0 +1,162 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/lrat_checker.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "gtest/gtest.h"
+#include "ortools/base/gmock.h"
+#include "ortools/base/helpers.h"
+#include "ortools/base/options.h"
+#include "ortools/base/path.h"
+#include "ortools/sat/sat_base.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+const double kMaxTimeInSeconds = std::numeric_limits<double>::infinity();
+
+std::vector<ClauseId> Ids(absl::Span<const int> ids) {
+  std::vector<ClauseId> result;
+  for (const int id : ids) result.push_back(ClauseId(id));
+  return result;
+}
+
+// Example from Fig. 3 of 'Trimming while Checking Clausal Proofs'.
+void AddExampleProblemClauses(LratChecker* checker) {
+  checker->AddProblemClause(ClauseId(1), Literals({-2, +3}));
+  checker->AddProblemClause(ClauseId(2), Literals({+1, +3}));
+  checker->AddProblemClause(ClauseId(3), Literals({-1, +2}));
+  checker->AddProblemClause(ClauseId(4), Literals({-1, -2}));
+  checker->AddProblemClause(ClauseId(5), Literals({+1, -2}));
+  checker->AddProblemClause(ClauseId(6), Literals({+2, -3}));
+}
+
+TEST(LratCheckerTest, CheckBasicSuccess) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+  checker.AddInferedClause(ClauseId(8), Literals({+3}), Ids({7, 2, 3}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 8, 6}));
+
+  EXPECT_EQ(LratChecker::Status::VALID, checker.Check(kMaxTimeInSeconds));
+  EXPECT_EQ(checker.num_checked_steps(), 3);
+}
+
+TEST(LratCheckerTest, CheckSuccessWithProblemClauseAfterInferedClauses) {
+  LratChecker checker;
+  checker.AddProblemClause(ClauseId(1), Literals({+1, +2}));
+  checker.AddProblemClause(ClauseId(2), Literals({+1, -2}));
+  checker.AddInferedClause(ClauseId(3), Literals({+1}), Ids({1, 2}));
+  checker.AddProblemClause(ClauseId(4), Literals({-1}));
+  checker.AddInferedClause(ClauseId(5), {}, Ids({3, 4}));
+
+  EXPECT_EQ(LratChecker::Status::VALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, CheckBasicSuccessWithSeveralThreads) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+  checker.AddInferedClause(ClauseId(8), Literals({+3}), Ids({7, 2, 3}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 8, 6}));
+
+  EXPECT_EQ(LratChecker::Status::VALID,
+            checker.Check(kMaxTimeInSeconds, /*num_threads=*/3));
+}
+
+TEST(LratCheckerTest, CheckFailsWithoutConflict) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+  checker.AddInferedClause(ClauseId(8), Literals({+3}), Ids({7, 2, 3}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 6}));
+
+  EXPECT_EQ(LratChecker::Status::INVALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, CheckFailsWithNonUnitHint) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({3, 5, 4}));
+  checker.AddInferedClause(ClauseId(8), Literals({+3}), Ids({7, 2, 3}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 8, 6}));
+
+  EXPECT_EQ(LratChecker::Status::INVALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, CheckFailsWithDeletedHint) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+  checker.AddInferedClause(ClauseId(8), Literals({+3}), Ids({7, 2, 3}));
+  checker.DeleteClauses(Ids({6}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 8, 6}));
+
+  EXPECT_EQ(LratChecker::Status::INVALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, CheckFailsWithoutEmptyClause) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+
+  EXPECT_EQ(LratChecker::Status::INVALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, CheckFailsWithNonIncreasingIds) {
+  LratChecker checker;
+  AddExampleProblemClauses(&checker);
+  checker.AddInferedClause(ClauseId(7), Literals({-2}), Ids({5, 4}));
+  checker.AddInferedClause(ClauseId(7), Literals({+3}), Ids({7, 2, 3}));
+  checker.AddInferedClause(ClauseId(9), {}, Ids({7, 8, 6}));
+
+  EXPECT_EQ(LratChecker::Status::INVALID, checker.Check(kMaxTimeInSeconds));
+}
+
+TEST(LratCheckerTest, AddProblemAndInferedClausesFromFiles) {
+  const std::string cnf_file_path =
+      file::JoinPath(::testing::TempDir(), "lrat_problem.cnf");
+  const std::string lrat_file_path =
+      file::JoinPath(::testing::TempDir(), "lrat_proof.lrat");
+  ASSERT_OK(file::SetContents(cnf_file_path,
+                             "p cnf 3 6\n"
+                             "-2 3 0\n"
+                             "1 3 0\n"
+                             "-1 2 0\n"
+                             "-1 -2 0\n"
+                             "1 -2 0\n"
+                             "2 -3 0\n",
+                             file::Defaults()));
+  ASSERT_OK(file::SetContents(lrat_file_path,
+                             "7 -2 0 5 4 0\n"
+                             "7 d 4 5 0\n"
+                             "8 3 0 7 2 3 0\n"
+                             "9 0 7 8 6 0\n",
+                             file::Defaults()));
+
+  LratChecker checker;
+  EXPECT_TRUE(AddProblemClauses(cnf_file_path, &checker));
+  EXPECT_TRUE(AddInferedAndDeletedClauses(lrat_file_path, &checker));
+  EXPECT_EQ(checker.num_variables(), 3);
+  EXPECT_EQ(LratChecker::Status::VALID, checker.Check(kMaxTimeInSeconds));
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,65 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/lrat_proof_handler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/types/span.h"
+#include "ortools/sat/lrat_checker.h"
+#include "ortools/sat/sat_base.h"
+
+namespace operations_research {
+namespace sat {
+
+void LratProofHandler::SetTmpClause(absl::Span<const Literal> clause) {
+  tmp_clause_.assign(clause.begin(), clause.end());
+  std::sort(tmp_clause_.begin(), tmp_clause_.end());
+}
+
+ClauseId LratProofHandler::AddProblemClause(absl::Span<const Literal> clause) {
+  const ClauseId id = next_id_++;
+  checker_.AddProblemClause(id, clause);
+  SetTmpClause(clause);
+  ids_[tmp_clause_].push_back(id);
+  return id;
+}
+
+ClauseId LratProofHandler::AddInferedClause(
+    absl::Span<const Literal> clause, absl::Span<const ClauseId> rup_hints) {
+  const ClauseId id = next_id_++;
+  checker_.AddInferedClause(id, clause, rup_hints);
+  SetTmpClause(clause);
+  ids_[tmp_clause_].push_back(id);
+  return id;
+}
+
+ClauseId LratProofHandler::GetClauseId(absl::Span<const Literal> clause) {
+  SetTmpClause(clause);
+  const auto it = ids_.find(tmp_clause_);
+  if (it == ids_.end()) return kNoClauseId;
+  return it->second.back();
+}
+
+void LratProofHandler::DeleteClause(absl::Span<const Literal> clause) {
+  SetTmpClause(clause);
+  const auto it = ids_.find(tmp_clause_);
+  if (it == ids_.end()) return;
+  checker_.DeleteClauses({it->second.back()});
+  it->second.pop_back();
+  if (it->second.empty()) ids_.erase(it);
+}
+
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,80 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OR_TOOLS_SAT_LRAT_PROOF_HANDLER_H_
+#define OR_TOOLS_SAT_LRAT_PROOF_HANDLER_H_
+
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/types/span.h"
+#include "ortools/sat/lrat_checker.h"
+#include "ortools/sat/sat_base.h"
+
+namespace operations_research {
+namespace sat {
+
+// The id returned for clauses which are not known by an LratProofHandler.
+const ClauseId kNoClauseId(0);
+
+// Records the problem and infered clauses of a SAT solver, with the hints of
+// the infered clauses, and checks the resulting LRAT proof with an in-memory
+// LratChecker.
+//
+// The solver refers to its clauses by their literals, and not by an id. This
+// class thus maintains the ids of each non-deleted clause, indexed by its set
+// of literals. Several clauses with the same literals can be added, in which
+// case the most recent one is used (and deleted first).
+class LratProofHandler {
+ public:
+  LratProofHandler() = default;
+
+  // This type is neither copyable nor movable.
+  LratProofHandler(const LratProofHandler&) = delete;
+  LratProofHandler& operator=(const LratProofHandler&) = delete;
+
+  // Adds a problem clause, or an infered clause which is derived by unit
+  // propagation of the clauses with the given ids, in this order. Returns the
+  // id of the new clause.
+  ClauseId AddProblemClause(absl::Span<const Literal> clause);
+  ClauseId AddInferedClause(absl::Span<const Literal> clause,
+                            absl::Span<const ClauseId> rup_hints);
+
+  // Returns the id of the most recent non-deleted clause with the given
+  // literals, or kNoClauseId if there is none.
+  ClauseId GetClauseId(absl::Span<const Literal> clause);
+
+  // Deletes the most recent clause with the given literals, if any.
+  void DeleteClause(absl::Span<const Literal> clause);
+
+  // Checks the proof recorded so far. See LratChecker::Check().
+  LratChecker::Status Check(double max_time_in_seconds, int num_threads = 1) {
+    return checker_.Check(max_time_in_seconds, num_threads);
+  }
+
+  const LratChecker& checker() const { return checker_; }
+
+ private:
+  // Sets 'tmp_clause_' to the sorted literals of the given clause.
+  void SetTmpClause(absl::Span<const Literal> clause);
+
+  ClauseId next_id_ = ClauseId(1);
+  absl::flat_hash_map<std::vector<Literal>, std::vector<ClauseId>> ids_;
+  std::vector<Literal> tmp_clause_;
+  LratChecker checker_;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_LRAT_PROOF_HANDLER_H_
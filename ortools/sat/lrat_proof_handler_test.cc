@@ -0,0 +1,94 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/lrat_proof_handler.h"
+
+#include <limits>
+
+#include "gtest/gtest.h"
+#include "ortools/base/gmock.h"
+#include "ortools/sat/lrat_checker.h"
+#include "ortools/sat/model.h"
+#include "ortools/sat/sat_base.h"
+#include "ortools/sat/sat_solver.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+const double kMaxTimeInSeconds = std::numeric_limits<double>::infinity();
+
+TEST(LratProofHandlerTest, ClauseIdsAreIndexedByLiterals) {
+  LratProofHandler handler;
+  const ClauseId id1 = handler.AddProblemClause(Literals({+1, -2}));
+  const ClauseId id2 = handler.AddProblemClause(Literals({-2, +1}));
+  EXPECT_NE(id1, id2);
+  EXPECT_EQ(handler.GetClauseId(Literals({+1, -2})), id2);
+  EXPECT_EQ(handler.GetClauseId(Literals({+1, +2})), kNoClauseId);
+
+  handler.DeleteClause(Literals({+1, -2}));
+  EXPECT_EQ(handler.GetClauseId(Literals({-2, +1})), id1);
+  handler.DeleteClause(Literals({-2, +1}));
+  EXPECT_EQ(handler.GetClauseId(Literals({-2, +1})), kNoClauseId);
+}
+
+// Adds the clauses stating that 4 pigeons fit in 3 holes.
+void AddPigeonHoleClauses(SatSolver* solver) {
+  const int kNumPigeons = 4;
+  const int kNumHoles = 3;
+  const auto in_hole = [](int pigeon, int hole) {
+    return Literal(BooleanVariable(pigeon * kNumHoles + hole), true);
+  };
+  solver->SetNumVariables(kNumPigeons * kNumHoles);
+  for (int p = 0; p < kNumPigeons; ++p) {
+    solver->AddProblemClause({in_hole(p, 0), in_hole(p, 1), in_hole(p, 2)});
+  }
+  for (int h = 0; h < kNumHoles; ++h) {
+    for (int p = 0; p < kNumPigeons; ++p) {
+      for (int q = p + 1; q < kNumPigeons; ++q) {
+        solver->AddProblemClause(
+            {in_hole(p, h).Negated(), in_hole(q, h).Negated()});
+      }
+    }
+  }
+}
+
+TEST(LratProofHandlerTest, SatSolverProducesValidProof) {
+  Model model;
+  SatSolver* solver = model.GetOrCreate<SatSolver>();
+  LratProofHandler handler;
+  solver->SetLratProofHandler(&handler);
+  AddPigeonHoleClauses(solver);
+
+  EXPECT_EQ(solver->Solve(), SatSolver::INFEASIBLE);
+  EXPECT_EQ(handler.Check(kMaxTimeInSeconds), LratChecker::Status::VALID);
+}
+
+TEST(LratProofHandlerTest, SatSolverProducesValidProofWithFixedLiterals) {
+  Model model;
+  SatSolver* solver = model.GetOrCreate<SatSolver>();
+  LratProofHandler handler;
+  solver->SetLratProofHandler(&handler);
+  solver->SetNumVariables(1);
+  // Fixing the first pigeon in the first hole makes the solver remove the
+  // false literals from the clauses added afterwards.
+  solver->AddUnitClause(Literal(BooleanVariable(0), true));
+  AddPigeonHoleClauses(solver);
+
+  EXPECT_EQ(solver->Solve(), SatSolver::INFEASIBLE);
+  EXPECT_EQ(handler.Check(kMaxTimeInSeconds), LratChecker::Status::VALID);
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
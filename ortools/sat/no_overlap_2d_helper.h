@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -214,6 +215,7 @@ class NoOverlap2DConstraintHelper : public PropagatorInterface {
 
   int NumBoxes() const { return x_helper_->NumTasks(); }
 
+  std::string Name() const override { return "NoOverlap2DConstraintHelper"; }
   bool Propagate() override;
 
   // Note that the helpers are only valid until the next call to
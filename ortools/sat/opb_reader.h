@@ -26,12 +26,14 @@
 #include "absl/container/flat_hash_set.h"
 #include "absl/log/check.h"
 #include "absl/log/log.h"
+#include "absl/strings/match.h"
 #include "absl/strings/numbers.h"
 #include "absl/strings/str_split.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/stl_util.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/cp_model_utils.h"
 #include "ortools/util/filelineiter.h"
@@ -56,6 +58,16 @@ class OpbReader {
   // contains an integer that does not fit in int64_t.
   bool model_is_supported() const { return model_is_supported_; }
 
+  // If more than one, the whole file is read in memory and split in chunks of
+  // lines that are parsed in parallel. The constraints are still added in the
+  // file order so the result is the same.
+  void SetNumParsingThreads(int num_threads) {
+    num_parsing_threads_ = std::max(num_threads, 1);
+  }
+
+  // The number of (uncompressed) bytes read by the last LoadAndValidate().
+  int64_t num_bytes_read() const { return num_bytes_read_; }
+
   // Loads the given opb filename into the given problem.
   // Returns true on success.
   ABSL_MUST_USE_RESULT bool LoadAndValidate(const std::string& filename,
@@ -66,16 +78,53 @@ class OpbReader {
     num_variables_ = 0;
     int num_lines = 0;
     model_is_supported_ = true;
+    num_bytes_read_ = 0;
+    objective_.clear();
+    constraints_.clear();
 
     // Read constraints line by line (1 constraint per line).
     // We process into a temporary structure to support non linear constraints
     // and weighted constraints.
-    for (const std::string& line : FileLines(filename)) {
-      ++num_lines;
-      ProcessNewLine(line);
-
-      // Check if the model is supported. It is not supported if one constant
-      // contains an integer that does not fit in an int64_t.
+    if (num_parsing_threads_ > 1) {
+      std::string content;
+      if (!ReadFileContent(filename, &content)) content.clear();
+      num_bytes_read_ = content.size();
+      num_lines = std::count(content.begin(), content.end(), '\n');
+      if (!content.empty() && content.back() != '\n') ++num_lines;
+      const std::vector<absl::string_view> chunks =
+          SplitIntoLineChunks(content, num_parsing_threads_);
+      std::vector<ParsedLines> parsed_chunks(chunks.size());
+      {
+        ThreadPool pool(num_parsing_threads_);
+        pool.StartWorkers();
+        for (int i = 0; i < chunks.size(); ++i) {
+          pool.Schedule([&chunks, &parsed_chunks, i]() {
+            for (const absl::string_view line :
+                 absl::StrSplit(chunks[i], '\n')) {
+              ProcessNewLine(line, &parsed_chunks[i]);
+
+              // No need to continue, the model will be rejected.
+              if (!parsed_chunks[i].model_is_supported) return;
+            }
+          });
+        }
+      }
+      for (ParsedLines& parsed : parsed_chunks) {
+        MergeParsedLines(&parsed);
+        if (!model_is_supported_) return false;
+      }
+    } else {
+      ParsedLines parsed;
+      for (const std::string& line : FileLines(filename)) {
+        ++num_lines;
+        num_bytes_read_ += line.size() + 1;
+        ProcessNewLine(line, &parsed);
+
+        // Check if the model is supported. It is not supported if one constant
+        // contains an integer that does not fit in an int64_t.
+        if (!parsed.model_is_supported) break;
+      }
+      MergeParsedLines(&parsed);
       if (!model_is_supported_) return false;
     }
     if (num_lines == 0) {
@@ -122,6 +171,27 @@ class OpbReader {
     int64_t soft_cost = std::numeric_limits<int64_t>::max();
   };
 
+  // What was parsed from a set of consecutive lines of the file. The lines do
+  // not depend on each other, so they can be parsed in parallel by chunks and
+  // merged in order.
+  struct ParsedLines {
+    int num_variables = 0;
+    bool model_is_supported = true;
+    std::vector<PbTerm> objective;
+    std::vector<PbConstraint> constraints;
+  };
+
+  void MergeParsedLines(ParsedLines* parsed) {
+    num_variables_ = std::max(num_variables_, parsed->num_variables);
+    model_is_supported_ = model_is_supported_ && parsed->model_is_supported;
+    for (PbTerm& term : parsed->objective) {
+      objective_.push_back(std::move(term));
+    }
+    for (PbConstraint& constraint : parsed->constraints) {
+      constraints_.push_back(std::move(constraint));
+    }
+  }
+
   // Since the problem name is not stored in the opb format, we infer it from
   // the file name.
   static std::string ExtractProblemName(const std::string& filename) {
@@ -131,8 +201,8 @@ class OpbReader {
     return problem_name;
   }
 
-  void ProcessNewLine(const std::string& line) {
-    const std::vector<std::string> words =
+  static void ProcessNewLine(absl::string_view line, ParsedLines* parsed) {
+    const std::vector<absl::string_view> words =
         absl::StrSplit(line, absl::ByAnyChar(" ;"), absl::SkipEmpty());
     if (words.empty() || words[0].empty() || words[0][0] == '*') {
       // TODO(user): Parse comments.
@@ -144,28 +214,28 @@ class OpbReader {
 
     if (words[0] == "min:") {
       for (int i = 1; i < words.size(); ++i) {
-        const std::string& word = words[i];
+        const absl::string_view word = words[i];
         if (word.empty() || word[0] == ';') continue;
         if (word[0] == 'x') {
           const int index = ParseIndex(word.substr(1));
-          num_variables_ = std::max(num_variables_, index);
-          objective_.back().literals.push_back(
+          parsed->num_variables = std::max(parsed->num_variables, index);
+          parsed->objective.back().literals.push_back(
               PbLiteralToCpModelLiteral(index));
-        } else if (word[0] == '~' && word[1] == 'x') {
+        } else if (absl::StartsWith(word, "~x")) {
           const int index = ParseIndex(word.substr(2));
-          num_variables_ = std::max(num_variables_, index);
-          objective_.back().literals.push_back(
+          parsed->num_variables = std::max(parsed->num_variables, index);
+          parsed->objective.back().literals.push_back(
               NegatedRef(PbLiteralToCpModelLiteral(index)));
         } else {
           // Note that coefficient always appear before the variable/variables.
           PbTerm term;
-          if (!ParseInt64Into(word, &term.coeff)) return;
-          objective_.emplace_back(std::move(term));
+          if (!ParseInt64Into(word, &term.coeff, parsed)) return;
+          parsed->objective.emplace_back(std::move(term));
         }
       }
 
       // Normalize objective literals.
-      for (PbTerm& term : objective_) {
+      for (PbTerm& term : parsed->objective) {
         if (term.literals.size() <= 1) continue;
         gtl::STLSortAndRemoveDuplicates(&term.literals);
         CHECK_GT(term.literals.size(), 1);
@@ -176,37 +246,37 @@ class OpbReader {
 
     PbConstraint constraint;
     for (int i = 0; i < words.size(); ++i) {
-      const std::string& word = words[i];
+      const absl::string_view word = words[i];
       CHECK(!word.empty());
       if (word[0] == '[') {  // Soft constraint.
         if (!ParseInt64Into(word.substr(1, word.size() - 2),
-                            &constraint.soft_cost)) {
+                            &constraint.soft_cost, parsed)) {
           return;
         }
       } else if (word == ">=") {
         CHECK_LT(i + 1, words.size());
         constraint.type = GE_OPERATION;
-        if (!ParseInt64Into(words[i + 1], &constraint.rhs)) return;
+        if (!ParseInt64Into(words[i + 1], &constraint.rhs, parsed)) return;
         break;
       } else if (word == "=") {
         CHECK_LT(i + 1, words.size());
         constraint.type = EQ_OPERATION;
-        if (!ParseInt64Into(words[i + 1], &constraint.rhs)) return;
+        if (!ParseInt64Into(words[i + 1], &constraint.rhs, parsed)) return;
         break;
       } else if (word[0] == 'x') {
         const int index = ParseIndex(word.substr(1));
-        num_variables_ = std::max(num_variables_, index);
+        parsed->num_variables = std::max(parsed->num_variables, index);
         constraint.terms.back().literals.push_back(
             PbLiteralToCpModelLiteral(index));
-      } else if (word[0] == '~' && word[1] == 'x') {
+      } else if (absl::StartsWith(word, "~x")) {
         const int index = ParseIndex(word.substr(2));
-        num_variables_ = std::max(num_variables_, index);
+        parsed->num_variables = std::max(parsed->num_variables, index);
         constraint.terms.back().literals.push_back(
             NegatedRef(PbLiteralToCpModelLiteral(index)));
       } else {
         // Note that coefficient always appear before the variable/variables.
         PbTerm term;
-        if (!ParseInt64Into(word, &term.coeff)) return;
+        if (!ParseInt64Into(word, &term.coeff, parsed)) return;
         constraint.terms.emplace_back(std::move(term));
       }
     }
@@ -218,7 +288,7 @@ class OpbReader {
       CHECK_GT(term.literals.size(), 1);
     }
 
-    constraints_.push_back(std::move(constraint));
+    parsed->constraints.push_back(std::move(constraint));
   }
 
   std::string ValidateModel() {
@@ -266,10 +336,11 @@ class OpbReader {
     return pb_literal > 0 ? pb_literal - 1 : -pb_literal;
   }
 
-  bool ParseInt64Into(const std::string& word, int64_t* value) {
+  static bool ParseInt64Into(absl::string_view word, int64_t* value,
+                             ParsedLines* parsed) {
     if (!absl::SimpleAtoi(word, value)) {
       VLOG(1) << "Failed to parse int64_t: " << word;
-      model_is_supported_ = false;
+      parsed->model_is_supported = false;
       return false;
     }
     return true;
@@ -371,6 +442,8 @@ class OpbReader {
   std::vector<PbConstraint> constraints_;
   absl::flat_hash_map<absl::Span<const int>, int> product_to_var_;
   bool model_is_supported_ = true;
+  int num_parsing_threads_ = 1;
+  int64_t num_bytes_read_ = 0;
 };
 
 }  // namespace sat
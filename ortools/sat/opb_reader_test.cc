@@ -13,6 +13,7 @@
 
 #include "ortools/sat/opb_reader.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -111,6 +112,49 @@ TEST(LoadAndValidateBooleanProblemTest, IntegerOverflow) {
   EXPECT_FALSE(reader.model_is_supported());
 }
 
+TEST(LoadAndValidateBooleanProblemTest, ParallelParsing) {
+  std::string file = "min: 1 x1 2 x2 3 x1 x3 ;\n";
+  for (int i = 1; i <= 100; ++i) {
+    absl::StrAppend(&file, "* comment ", i, "\n");
+    absl::StrAppend(&file, i % 7 == 0 ? absl::StrCat("[", i, "] ") : "", i,
+                    " x", 1 + i % 13, " ", i % 5 + 1, " x", 1 + (5 * i) % 13,
+                    " ~x", 1 + (3 * i) % 13, i % 2 == 0 ? " >= " : " = ",
+                    i % 3, " ;\n");
+  }
+  const std::string filename =
+      file::JoinPath(::testing::TempDir(), "parallel.opb");
+  CHECK_OK(file::SetContents(filename, file, file::Defaults()));
+
+  CpModelProto expected;
+  OpbReader reader;
+  CHECK(reader.LoadAndValidate(filename, &expected));
+  EXPECT_EQ(reader.num_bytes_read(), static_cast<int64_t>(file.size()));
+  for (const int num_threads : {2, 3, 8}) {
+    CpModelProto problem;
+    OpbReader parallel_reader;
+    parallel_reader.SetNumParsingThreads(num_threads);
+    CHECK(parallel_reader.LoadAndValidate(filename, &problem));
+    EXPECT_EQ(parallel_reader.num_bytes_read(),
+              static_cast<int64_t>(file.size()));
+    EXPECT_EQ(parallel_reader.num_variables(), reader.num_variables());
+    EXPECT_EQ(problem.SerializeAsString(), expected.SerializeAsString());
+  }
+}
+
+TEST(LoadAndValidateBooleanProblemTest, ParallelParsingIntegerOverflow) {
+  std::string file = "min: 1 x1 1 x2 ;\n";
+  for (int i = 0; i < 100; ++i) absl::StrAppend(&file, "1 x1 2 x2 >= 1 ;\n");
+  absl::StrAppend(&file, "1 x1 123456789123456789123456789 x2 >= 1 ;\n");
+  const std::string filename =
+      file::JoinPath(::testing::TempDir(), "parallel_overflow.opb");
+  CHECK_OK(file::SetContents(filename, file, file::Defaults()));
+  CpModelProto problem;
+  OpbReader reader;
+  reader.SetNumParsingThreads(4);
+  EXPECT_FALSE(reader.LoadAndValidate(filename, &problem));
+  EXPECT_FALSE(reader.model_is_supported());
+}
+
 void FindSymmetries(
     absl::string_view file,
     std::vector<std::unique_ptr<SparsePermutation>>* generators) {
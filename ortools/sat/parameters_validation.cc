@@ -102,6 +102,8 @@ std::string ValidateParameters(const SatParameters& params) {
   TEST_IN_RANGE(lns_initial_difficulty, 0.0, 1.0);
 
   TEST_POSITIVE(at_most_one_max_expansion_size);
+  TEST_POSITIVE(presolve_num_threads);
+  TEST_POSITIVE(feasibility_jump_max_moves_per_scan);
   TEST_POSITIVE(max_alldiff_domain_size);
 
   TEST_NOT_NAN(max_time_in_seconds);
@@ -156,6 +158,7 @@ std::string ValidateParameters(const SatParameters& params) {
   TEST_NON_NEGATIVE(new_constraints_batch_size);
   TEST_NON_NEGATIVE(presolve_probing_deterministic_time_limit);
   TEST_NON_NEGATIVE(probing_deterministic_time_limit);
+  TEST_NON_NEGATIVE(propagator_stats_sampling_period);
   TEST_NON_NEGATIVE(symmetry_detection_deterministic_time_limit);
   TEST_POSITIVE(share_glue_clauses_dtime);
 
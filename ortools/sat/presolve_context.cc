@@ -2499,9 +2499,18 @@ bool LoadModelForPresolve(const CpModelProto& model_proto, SatParameters params,
                           PresolveContext* context, Model* local_model,
                           absl::string_view name_for_logging) {
   *local_model->GetOrCreate<SatParameters>() = std::move(params);
-  local_model->GetOrCreate<TimeLimit>()->MergeWithGlobalTimeLimit(
-      context->time_limit());
-  local_model->Register<ModelRandomGenerator>(context->random());
+  if (context != nullptr) {
+    local_model->GetOrCreate<TimeLimit>()->MergeWithGlobalTimeLimit(
+        context->time_limit());
+    // A model can come with its own random generator.
+    if (local_model->Get<ModelRandomGenerator>() == nullptr) {
+      local_model->Register<ModelRandomGenerator>(context->random());
+    }
+  }
+  const auto notify_unsat = [context](absl::string_view message) {
+    if (context == nullptr) return false;
+    return context->NotifyThatModelIsUnsat(message);
+  };
   auto* encoder = local_model->GetOrCreate<IntegerEncoder>();
   encoder->DisableImplicationBetweenLiteral();
   auto* mapping = local_model->GetOrCreate<CpModelMapping>();
@@ -2514,23 +2523,21 @@ bool LoadModelForPresolve(const CpModelProto& model_proto, SatParameters params,
   ExtractEncoding(model_proto, local_model);
   auto* sat_solver = local_model->GetOrCreate<SatSolver>();
   if (sat_solver->ModelIsUnsat()) {
-    return context->NotifyThatModelIsUnsat(
-        absl::StrCat("Initial loading for ", name_for_logging));
+    return notify_unsat(absl::StrCat("Initial loading for ", name_for_logging));
   }
   for (const ConstraintProto& ct : model_proto.constraints()) {
     if (mapping->ConstraintIsAlreadyLoaded(&ct)) continue;
     CHECK(LoadConstraint(ct, local_model));
     if (sat_solver->ModelIsUnsat()) {
-      return context->NotifyThatModelIsUnsat(
-          absl::StrCat("after loading constraint during ", name_for_logging,
-                       " ", ProtobufShortDebugString(ct)));
+      return notify_unsat(absl::StrCat("after loading constraint during ",
+                                       name_for_logging, " ",
+                                       ProtobufShortDebugString(ct)));
     }
   }
   encoder->AddAllImplicationsBetweenAssociatedLiterals();
   if (sat_solver->ModelIsUnsat()) return false;
   if (!sat_solver->Propagate()) {
-    return context->NotifyThatModelIsUnsat(
-        "during probing initial propagation");
+    return notify_unsat("during probing initial propagation");
   }
 
   return true;
@@ -666,6 +666,13 @@ class PresolveContext {
   // Advanced presolve. See this class comment.
   DomainDeductions deductions;
 
+  // If not empty, the orbits of the variables under the full symmetry group
+  // found during presolve, in the format of GetOrbits(). They are remapped with
+  // the variables, and the variables not present when they were computed are
+  // all put in an extra orbit. This is used to speed up the symmetry detection
+  // after presolve, see FindCpModelSymmetries().
+  std::vector<int> symmetry_orbits;
+
   // Adds a new constraint to the mapping proto. The version with the base
   // constraint will copy that constraint to the new constraint.
   //
@@ -794,6 +801,10 @@ class PresolveContext {
 // that will be used for probing. Returns false if UNSAT.
 bool LoadModelForProbing(PresolveContext* context, Model* local_model);
 
+// Loads the given model in local_model. Returns false if UNSAT, in which case
+// the context, if not null, is notified. With a null context, the time limit
+// and the random generator of local_model are not linked to the presolve ones,
+// this allows to load many models in parallel.
 bool LoadModelForPresolve(const CpModelProto& model_proto, SatParameters params,
                           PresolveContext* context, Model* local_model,
                           absl::string_view name_for_logging);
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -29,6 +30,7 @@
 #include "absl/types/span.h"
 #include "ortools/base/logging.h"
 #include "ortools/base/strong_vector.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/base/timer.h"
 #include "ortools/sat/clause.h"
 #include "ortools/sat/implied_bounds.h"
@@ -59,19 +61,22 @@ Prober::Prober(Model* model)
       implication_graph_(model->GetOrCreate<BinaryImplicationGraph>()),
       logger_(model->GetOrCreate<SolverLogger>()) {}
 
-bool Prober::ProbeBooleanVariables(const double deterministic_time_limit) {
+std::vector<BooleanVariable> Prober::VariablesToProbe() const {
   const int num_variables = sat_solver_->NumVariables();
-  const VariablesAssignment& assignment = sat_solver_->Assignment();
   std::vector<BooleanVariable> bool_vars;
   for (BooleanVariable b(0); b < num_variables; ++b) {
-    if (assignment.VariableIsAssigned(b)) continue;
+    if (assignment_.VariableIsAssigned(b)) continue;
     const Literal literal(b, true);
     if (implication_graph_->RepresentativeOf(literal) != literal) {
       continue;
     }
     bool_vars.push_back(b);
   }
-  return ProbeBooleanVariables(deterministic_time_limit, bool_vars);
+  return bool_vars;
+}
+
+bool Prober::ProbeBooleanVariables(const double deterministic_time_limit) {
+  return ProbeBooleanVariables(deterministic_time_limit, VariablesToProbe());
 }
 
 bool Prober::ProbeOneVariableInternal(BooleanVariable b) {
@@ -127,6 +132,11 @@ bool Prober::ProbeOneVariableInternal(BooleanVariable b) {
     for (auto binary : new_binary_clauses_) {
       sat_solver_->AddBinaryClause(binary.first, binary.second);
     }
+    if (exported_binary_clauses_ != nullptr) {
+      exported_binary_clauses_->insert(exported_binary_clauses_->end(),
+                                       new_binary_clauses_.begin(),
+                                       new_binary_clauses_.end());
+    }
     new_binary_clauses_.clear();
     if (!sat_solver_->FinishPropagation()) return false;
   }
@@ -303,6 +313,183 @@ bool Prober::ProbeBooleanVariables(
   return true;
 }
 
+bool Prober::ProbeBooleanVariablesInParallel(
+    const double deterministic_time_limit, const int num_workers,
+    const std::function<bool(int worker, Model* copy)>& load_copy) {
+  if (num_workers <= 1) return ProbeBooleanVariables(deterministic_time_limit);
+
+  WallTimer wall_timer;
+  wall_timer.Start();
+
+  // Reset statistics.
+  num_decisions_ = 0;
+  num_new_binary_ = 0;
+  num_new_holes_ = 0;
+  num_new_integer_bounds_ = 0;
+  num_new_literals_fixed_ = 0;
+
+  // Reset the solver in case it was already used.
+  if (!sat_solver_->ResetToLevelZero()) return false;
+  const int initial_num_fixed = sat_solver_->LiteralTrail().Index();
+
+  struct Worker {
+    Model model;
+    std::vector<BooleanVariable> bool_vars;
+    std::vector<std::pair<Literal, Literal>> binary_clauses;
+    bool is_loaded = false;
+    double deterministic_time = 0.0;
+  };
+  std::vector<std::unique_ptr<Worker>> workers;
+  for (int w = 0; w < num_workers; ++w) {
+    workers.push_back(std::make_unique<Worker>());
+  }
+  const std::vector<BooleanVariable> bool_vars = VariablesToProbe();
+  for (int i = 0; i < bool_vars.size(); ++i) {
+    workers[i % num_workers]->bool_vars.push_back(bool_vars[i]);
+  }
+
+  // Each worker only works on its own model, so they do not need any
+  // synchronization. Our time limit is only read while they run.
+  const double worker_time_limit = deterministic_time_limit / num_workers;
+  {
+    ThreadPool pool(num_workers);
+    pool.StartWorkers();
+    for (int w = 0; w < num_workers; ++w) {
+      pool.Schedule([this, w, worker = workers[w].get(), worker_time_limit,
+                     &load_copy]() {
+        worker->model.GetOrCreate<TimeLimit>()->MergeWithGlobalTimeLimit(
+            time_limit_);
+        worker->is_loaded = load_copy(w, &worker->model);
+        if (!worker->is_loaded) return;
+        Prober* prober = worker->model.GetOrCreate<Prober>();
+        prober->exported_binary_clauses_ = &worker->binary_clauses;
+        const TimeLimit* time_limit = worker->model.GetOrCreate<TimeLimit>();
+        const double initial_time = time_limit->GetElapsedDeterministicTime();
+        prober->ProbeBooleanVariables(worker_time_limit, worker->bool_vars);
+        worker->deterministic_time =
+            time_limit->GetElapsedDeterministicTime() - initial_time;
+      });
+    }
+  }
+
+  int num_probed = 0;
+  double deterministic_time = 0.0;
+  for (const std::unique_ptr<Worker>& worker : workers) {
+    if (!worker->is_loaded) {
+      sat_solver_->NotifyThatModelIsUnsat();
+      return false;
+    }
+    const Prober& prober = *worker->model.GetOrCreate<Prober>();
+    num_decisions_ += prober.num_decisions();
+    num_new_binary_ += prober.num_new_binary_clauses();
+    num_probed += worker->bool_vars.size();
+    deterministic_time += worker->deterministic_time;
+    if (!MergeDeductionsFrom(&worker->model, worker->binary_clauses)) {
+      sat_solver_->NotifyThatModelIsUnsat();
+      return false;
+    }
+  }
+  time_limit_->AdvanceDeterministicTime(deterministic_time);
+
+  // Update stats.
+  const int num_fixed = sat_solver_->LiteralTrail().Index();
+  num_new_literals_fixed_ = num_fixed - initial_num_fixed;
+
+  // Display stats.
+  if (logger_->LoggingIsEnabled()) {
+    SOLVER_LOG(logger_, "[Probing] workers: ", num_workers,
+               " deterministic_time: ", deterministic_time,
+               " (limit: ", deterministic_time_limit,
+               ") wall_time: ", wall_timer.Get(), " (", num_decisions_,
+               " decisions on ", num_probed, " variables)");
+    if (num_new_literals_fixed_ > 0) {
+      SOLVER_LOG(logger_,
+                 "[Probing]  - new fixed Boolean: ", num_new_literals_fixed_,
+                 " (", num_fixed, "/", sat_solver_->NumVariables(), ")");
+    }
+    if (num_new_holes_ > 0) {
+      SOLVER_LOG(logger_, "[Probing]  - new integer holes: ", num_new_holes_);
+    }
+    if (num_new_integer_bounds_ > 0) {
+      SOLVER_LOG(logger_,
+                 "[Probing]  - new integer bounds: ", num_new_integer_bounds_);
+    }
+    if (num_new_binary_ > 0) {
+      SOLVER_LOG(logger_, "[Probing]  - new binary clause: ", num_new_binary_);
+    }
+  }
+
+  return true;
+}
+
+bool Prober::MergeDeductionsFrom(
+    Model* copy, absl::Span<const std::pair<Literal, Literal>> binary_clauses) {
+  auto* copy_sat_solver = copy->GetOrCreate<SatSolver>();
+  if (!copy_sat_solver->ResetToLevelZero()) return false;
+
+  // We ignore anything about the variables created while probing the copy.
+  const int num_variables = sat_solver_->NumVariables();
+  const IntegerVariable num_integer_variables =
+      integer_trail_->NumIntegerVariables();
+  const auto is_known = [num_variables](Literal l) {
+    return l.Variable() < num_variables;
+  };
+
+  // Fixed literals and binary clauses.
+  const Trail& copy_trail = *copy->GetOrCreate<Trail>();
+  for (int i = 0; i < copy_trail.Index(); ++i) {
+    const Literal l = copy_trail[i];
+    if (!is_known(l) || assignment_.LiteralIsTrue(l)) continue;
+    if (!sat_solver_->AddUnitClause(l)) return false;
+  }
+  for (const auto [a, b] : binary_clauses) {
+    if (!is_known(a) || !is_known(b)) continue;
+    if (!sat_solver_->AddBinaryClause(a, b)) return false;
+  }
+  if (!sat_solver_->FinishPropagation()) return false;
+
+  // The level zero domains of the copy are valid here too. Like in
+  // ProbeOneVariableInternal(), the bounds are pushed and only the holes
+  // change the initial domain.
+  auto* copy_integer_trail = copy->GetOrCreate<IntegerTrail>();
+  for (IntegerVariable var(0); var < num_integer_variables; var += 2) {
+    const IntegerValue lb = integer_trail_->LevelZeroLowerBound(var);
+    const IntegerValue ub = integer_trail_->LevelZeroUpperBound(var);
+    const Domain domain = integer_trail_->InitialVariableDomain(var)
+                              .IntersectionWith(Domain(lb.value(), ub.value()));
+    const Domain copy_domain =
+        copy_integer_trail->InitialVariableDomain(var).IntersectionWith(
+            Domain(copy_integer_trail->LevelZeroLowerBound(var).value(),
+                   copy_integer_trail->LevelZeroUpperBound(var).value()));
+    const Domain new_domain = domain.IntersectionWith(copy_domain);
+    if (new_domain == domain) continue;
+    if (new_domain.IsEmpty()) return false;
+
+    const IntegerValue new_lb(new_domain.Min());
+    const IntegerValue new_ub(new_domain.Max());
+    if (new_lb > lb) {
+      ++num_new_integer_bounds_;
+      if (!integer_trail_->Enqueue(IntegerLiteral::GreaterOrEqual(var, new_lb),
+                                   {}, {})) {
+        return false;
+      }
+    }
+    if (new_ub < ub) {
+      ++num_new_integer_bounds_;
+      if (!integer_trail_->Enqueue(IntegerLiteral::LowerOrEqual(var, new_ub),
+                                   {}, {})) {
+        return false;
+      }
+    }
+    if (new_domain != domain.IntersectionWith(
+                          Domain(new_lb.value(), new_ub.value()))) {
+      ++num_new_holes_;
+      if (!integer_trail_->UpdateInitialDomain(var, new_domain)) return false;
+    }
+  }
+  return sat_solver_->FinishPropagation();
+}
+
 bool Prober::ProbeDnf(absl::string_view name,
                       absl::Span<const std::vector<Literal>> dnf) {
   if (dnf.size() <= 1) return true;
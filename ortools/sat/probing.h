@@ -82,6 +82,26 @@ class Prober {
   bool ProbeBooleanVariables(double deterministic_time_limit,
                              absl::Span<const BooleanVariable> bool_vars);
 
+  // Same as the first method but the variables are distributed round-robin
+  // between num_workers threads. Each thread probes its variables on its own
+  // copy of the problem, created by load_copy(worker, copy), with a
+  // deterministic time limit of deterministic_time_limit / num_workers. The
+  // copies must have the same Boolean and integer variables as the problem of
+  // this class, this is the case if they are loaded in the same way.
+  //
+  // load_copy() is called from the worker threads, so it must not modify any
+  // shared state. It must return false if the copy is infeasible, the problem
+  // of this class is then marked as UNSAT here.
+  //
+  // The fixed literals, new binary clauses and integer domains found on each
+  // copy are then merged here, in the worker order, so the result does not
+  // depend on the thread scheduling. Note that the propagation callback is not
+  // called in this mode, and that the implied bounds found on the copies are
+  // lost. This is only used during presolve where they are not needed.
+  bool ProbeBooleanVariablesInParallel(
+      double deterministic_time_limit, int num_workers,
+      const std::function<bool(int worker, Model* copy)>& load_copy);
+
   bool ProbeOneVariable(BooleanVariable b);
 
   // Probes the given problem DNF (disjunction of conjunctions). Since one of
@@ -105,8 +125,19 @@ class Prober {
   }
 
  private:
+  // Returns the unassigned Boolean variables whose positive literal is its own
+  // representative.
+  std::vector<BooleanVariable> VariablesToProbe() const;
+
   bool ProbeOneVariableInternal(BooleanVariable b);
 
+  // Merges in this problem what was found while probing the given copy. The
+  // binary clauses are not stored in the copy model and are given separately.
+  // The implied bounds are not merged, they are not used during presolve.
+  bool MergeDeductionsFrom(
+      Model* copy,
+      absl::Span<const std::pair<Literal, Literal>> binary_clauses);
+
   // Model owned classes.
   const Trail& trail_;
   const VariablesAssignment& assignment_;
@@ -131,6 +162,11 @@ class Prober {
   absl::btree_map<IntegerVariable, IntegerValue> new_propagated_bounds_;
   absl::btree_map<IntegerVariable, IntegerValue> always_propagated_bounds_;
 
+  // If not null, the new binary clauses found are also appended there. This is
+  // used to export them from a copy of the problem in
+  // ProbeBooleanVariablesInParallel().
+  std::vector<std::pair<Literal, Literal>>* exported_binary_clauses_ = nullptr;
+
   // Probing statistics.
   int num_decisions_ = 0;
   int num_new_holes_ = 0;
@@ -55,6 +55,77 @@ TEST(ProbeBooleanVariablesTest, IntegerBoundInference) {
   EXPECT_EQ("[0,4][7,10]", integer_trail->InitialVariableDomain(c).ToString());
 }
 
+struct ProbingProblem {
+  BooleanVariable a;
+  BooleanVariable d;
+  IntegerVariable b;
+  IntegerVariable c;
+};
+
+// Creates the same variables and constraints in any model, this is needed for
+// the copies used by ProbeBooleanVariablesInParallel().
+ProbingProblem LoadProbingProblem(Model* model) {
+  const BooleanVariable a = model->Add(NewBooleanVariable());
+  const BooleanVariable d = model->Add(NewBooleanVariable());
+  const IntegerVariable b = model->Add(NewIntegerVariable(0, 10));
+  const IntegerVariable c = model->Add(NewIntegerVariable(0, 10));
+
+  // Bound restriction.
+  model->Add(Implication({Literal(a, true)},
+                         IntegerLiteral::GreaterOrEqual(b, IntegerValue(2))));
+  model->Add(Implication({Literal(a, false)},
+                         IntegerLiteral::GreaterOrEqual(b, IntegerValue(3))));
+
+  // Hole.
+  model->Add(Implication({Literal(a, true)},
+                         IntegerLiteral::GreaterOrEqual(c, IntegerValue(7))));
+  model->Add(Implication({Literal(a, false)},
+                         IntegerLiteral::LowerOrEqual(c, IntegerValue(4))));
+
+  // d cannot be true.
+  model->Add(Implication({Literal(d, true)},
+                         IntegerLiteral::GreaterOrEqual(b, IntegerValue(8))));
+  model->Add(Implication({Literal(d, true)},
+                         IntegerLiteral::LowerOrEqual(b, IntegerValue(5))));
+  return {.a = a, .d = d, .b = b, .c = c};
+}
+
+TEST(ProbeBooleanVariablesTest, ParallelProbingMergesAllDeductions) {
+  Model model;
+  const ProbingProblem problem = LoadProbingProblem(&model);
+
+  // With two workers, a and d are probed on different copies.
+  Prober* prober = model.GetOrCreate<Prober>();
+  EXPECT_TRUE(prober->ProbeBooleanVariablesInParallel(
+      /*deterministic_time_limit=*/1.0, /*num_workers=*/2,
+      [](int /*worker*/, Model* copy) {
+        LoadProbingProblem(copy);
+        return !copy->GetOrCreate<SatSolver>()->ModelIsUnsat();
+      }));
+
+  const VariablesAssignment& assignment =
+      model.GetOrCreate<SatSolver>()->Assignment();
+  EXPECT_TRUE(assignment.LiteralIsFalse(Literal(problem.d, true)));
+  EXPECT_FALSE(assignment.VariableIsAssigned(problem.a));
+  auto* integer_trail = model.GetOrCreate<IntegerTrail>();
+  EXPECT_EQ(integer_trail->LevelZeroLowerBound(problem.b), IntegerValue(2));
+  EXPECT_EQ("[0,4][7,10]",
+            integer_trail->InitialVariableDomain(problem.c).ToString());
+}
+
+TEST(ProbeBooleanVariablesTest, ParallelProbingWithInfeasibleCopy) {
+  Model model;
+  LoadProbingProblem(&model);
+  Prober* prober = model.GetOrCreate<Prober>();
+  EXPECT_FALSE(prober->ProbeBooleanVariablesInParallel(
+      /*deterministic_time_limit=*/1.0, /*num_workers=*/2,
+      [](int worker, Model* copy) {
+        LoadProbingProblem(copy);
+        return worker == 0;
+      }));
+  EXPECT_TRUE(model.GetOrCreate<SatSolver>()->ModelIsUnsat());
+}
+
 TEST(FailedLiteralProbingRoundTest, TrivialExample) {
   Model model;
   const Literal a(model.Add(NewBooleanVariable()), true);
@@ -0,0 +1,531 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/remote_sharing.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif  // !defined(_WIN32)
+
+#include "absl/algorithm/container.h"
+#include "absl/container/btree_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_checker.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/sat/integer_base.h"
+#include "ortools/sat/remote_sharing.pb.h"
+#include "ortools/sat/subsolver.h"
+#include "ortools/sat/synchronization.h"
+
+#if !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace operations_research {
+namespace sat {
+
+namespace {
+
+// Size of the little endian size prefix of each message.
+constexpr int kHeaderSize = 4;
+
+#if !defined(_WIN32)
+absl::Status ErrnoToStatus(absl::string_view function) {
+  return absl::InternalError(absl::StrCat(function, "(): ", strerror(errno)));
+}
+
+// Waits for one peer to connect to the given socket, which must be bound.
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>> AcceptOne(
+    int listen_fd) {
+  if (listen(listen_fd, 1) != 0) {
+    const absl::Status status = ErrnoToStatus("listen");
+    close(listen_fd);
+    return status;
+  }
+  const int fd = accept(listen_fd, nullptr, nullptr);
+  const absl::Status status = ErrnoToStatus("accept");
+  close(listen_fd);
+  if (fd < 0) return status;
+  return std::make_unique<SocketSharingTransport>(fd);
+}
+
+absl::StatusOr<sockaddr_un> UnixSocketAddress(const std::string& path) {
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.size() >= sizeof(address.sun_path)) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("Unix socket path is too long: ", path));
+  }
+  memcpy(address.sun_path, path.data(), path.size());
+  return address;
+}
+#endif  // !defined(_WIN32)
+
+}  // namespace
+
+#if !defined(_WIN32)
+
+SocketSharingTransport::SocketSharingTransport(int socket_fd)
+    : socket_fd_(socket_fd) {}
+
+SocketSharingTransport::~SocketSharingTransport() { close(socket_fd_); }
+
+absl::StatusOr<std::pair<std::unique_ptr<SocketSharingTransport>,
+                         std::unique_ptr<SocketSharingTransport>>>
+SocketSharingTransport::CreatePair() {
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+    return ErrnoToStatus("socketpair");
+  }
+  return std::make_pair(std::make_unique<SocketSharingTransport>(fds[0]),
+                        std::make_unique<SocketSharingTransport>(fds[1]));
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::AcceptOnUnixSocket(const std::string& path) {
+  absl::StatusOr<sockaddr_un> address = UnixSocketAddress(path);
+  if (!address.ok()) return address.status();
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return ErrnoToStatus("socket");
+
+  // Only remove a stale socket left by a previous run, never another file.
+  struct stat file_status;
+  if (lstat(path.c_str(), &file_status) == 0) {
+    if (!S_ISSOCK(file_status.st_mode)) {
+      close(fd);
+      return absl::FailedPreconditionError(
+          absl::StrCat(path, " exists and is not a socket"));
+    }
+    unlink(path.c_str());
+  }
+  if (bind(fd, reinterpret_cast<const sockaddr*>(&*address),
+           sizeof(*address)) != 0) {
+    const absl::Status status = ErrnoToStatus("bind");
+    close(fd);
+    return status;
+  }
+  return AcceptOne(fd);
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::ConnectToUnixSocket(const std::string& path) {
+  absl::StatusOr<sockaddr_un> address = UnixSocketAddress(path);
+  if (!address.ok()) return address.status();
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return ErrnoToStatus("socket");
+  if (connect(fd, reinterpret_cast<const sockaddr*>(&*address),
+              sizeof(*address)) != 0) {
+    const absl::Status status = ErrnoToStatus("connect");
+    close(fd);
+    return status;
+  }
+  return std::make_unique<SocketSharingTransport>(fd);
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::AcceptOnTcpPort(int port,
+                                        const std::string& bind_address) {
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST;
+  addrinfo* addresses = nullptr;
+  const int error = getaddrinfo(bind_address.c_str(),
+                                absl::StrCat(port).c_str(), &hints, &addresses);
+  if (error != 0) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("getaddrinfo(): ", gai_strerror(error)));
+  }
+  absl::Status status = absl::NotFoundError(
+      absl::StrCat("No address found for ", bind_address, ":", port));
+  for (addrinfo* a = addresses; a != nullptr; a = a->ai_next) {
+    const int fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+    if (fd < 0) {
+      status = ErrnoToStatus("socket");
+      continue;
+    }
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, a->ai_addr, a->ai_addrlen) == 0) {
+      freeaddrinfo(addresses);
+      return AcceptOne(fd);
+    }
+    status = ErrnoToStatus("bind");
+    close(fd);
+  }
+  freeaddrinfo(addresses);
+  return status;
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::ConnectToTcpPort(const std::string& host, int port) {
+  addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* addresses = nullptr;
+  const int error = getaddrinfo(host.c_str(), absl::StrCat(port).c_str(),
+                                &hints, &addresses);
+  if (error != 0) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("getaddrinfo(): ", gai_strerror(error)));
+  }
+  absl::Status status = absl::NotFoundError(
+      absl::StrCat("No address found for ", host, ":", port));
+  for (addrinfo* a = addresses; a != nullptr; a = a->ai_next) {
+    const int fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+    if (fd < 0) {
+      status = ErrnoToStatus("socket");
+      continue;
+    }
+    if (connect(fd, a->ai_addr, a->ai_addrlen) == 0) {
+      freeaddrinfo(addresses);
+      return std::make_unique<SocketSharingTransport>(fd);
+    }
+    status = ErrnoToStatus("connect");
+    close(fd);
+  }
+  freeaddrinfo(addresses);
+  return status;
+}
+
+bool SocketSharingTransport::Send(absl::string_view message) {
+  if (is_broken_) return false;
+  if (!WritePendingBytes()) {
+    is_broken_ = true;
+    return false;
+  }
+  const int64_t num_pending_bytes = send_buffer_.size() - num_bytes_sent_;
+  if (num_pending_bytes + kHeaderSize + message.size() > kMaxPendingBytes) {
+    return false;
+  }
+
+  send_buffer_.erase(0, num_bytes_sent_);
+  num_bytes_sent_ = 0;
+  const uint32_t size = message.size();
+  for (int i = 0; i < kHeaderSize; ++i) {
+    send_buffer_.push_back(static_cast<char>((size >> (8 * i)) & 0xFF));
+  }
+  send_buffer_.append(message);
+  if (!WritePendingBytes()) {
+    is_broken_ = true;
+    return false;
+  }
+  return true;
+}
+
+bool SocketSharingTransport::WritePendingBytes() {
+  while (num_bytes_sent_ < send_buffer_.size()) {
+    const ssize_t n = send(socket_fd_, send_buffer_.data() + num_bytes_sent_,
+                           send_buffer_.size() - num_bytes_sent_,
+                           MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (n > 0) {
+      num_bytes_sent_ += n;
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+    return false;
+  }
+  send_buffer_.clear();
+  num_bytes_sent_ = 0;
+  return true;
+}
+
+bool SocketSharingTransport::ReadAvailableBytes() {
+  char chunk[4096];
+  while (true) {
+    const ssize_t n = recv(socket_fd_, chunk, sizeof(chunk), MSG_DONTWAIT);
+    if (n > 0) {
+      buffer_.append(chunk, n);
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+    return false;
+  }
+}
+
+bool SocketSharingTransport::Receive(std::string* message) {
+  // Note that we still return the messages received before the channel broke.
+  if (!is_broken_ && (!WritePendingBytes() || !ReadAvailableBytes())) {
+    is_broken_ = true;
+  }
+  if (buffer_.size() < kHeaderSize) return false;
+  uint32_t size = 0;
+  for (int i = 0; i < kHeaderSize; ++i) {
+    size |= static_cast<uint32_t>(static_cast<uint8_t>(buffer_[i])) << (8 * i);
+  }
+  if (buffer_.size() < kHeaderSize + size) return false;
+  message->assign(buffer_, kHeaderSize, size);
+  buffer_.erase(0, kHeaderSize + size);
+  return true;
+}
+
+#else  // !defined(_WIN32)
+
+SocketSharingTransport::SocketSharingTransport(int socket_fd)
+    : socket_fd_(socket_fd), is_broken_(true) {}
+
+SocketSharingTransport::~SocketSharingTransport() = default;
+
+absl::StatusOr<std::pair<std::unique_ptr<SocketSharingTransport>,
+                         std::unique_ptr<SocketSharingTransport>>>
+SocketSharingTransport::CreatePair() {
+  return absl::UnimplementedError("Sockets are not supported on Windows.");
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::AcceptOnUnixSocket(const std::string& /*path*/) {
+  return absl::UnimplementedError("Sockets are not supported on Windows.");
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::ConnectToUnixSocket(const std::string& /*path*/) {
+  return absl::UnimplementedError("Sockets are not supported on Windows.");
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::AcceptOnTcpPort(int /*port*/,
+                                        const std::string& /*bind_address*/) {
+  return absl::UnimplementedError("Sockets are not supported on Windows.");
+}
+
+absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+SocketSharingTransport::ConnectToTcpPort(const std::string& /*host*/,
+                                         int /*port*/) {
+  return absl::UnimplementedError("Sockets are not supported on Windows.");
+}
+
+bool SocketSharingTransport::Send(absl::string_view /*message*/) {
+  return false;
+}
+
+bool SocketSharingTransport::ReadAvailableBytes() { return false; }
+
+bool SocketSharingTransport::WritePendingBytes() { return false; }
+
+bool SocketSharingTransport::Receive(std::string* /*message*/) {
+  return false;
+}
+
+#endif  // !defined(_WIN32)
+
+RemoteSharingHelper::RemoteSharingHelper(SharingTransport* transport,
+                                         const CpModelProto* model_proto,
+                                         SharedResponseManager* response,
+                                         SharedBoundsManager* bounds,
+                                         SharedClausesManager* clauses)
+    : SubSolver("remote_sharing", HELPER),
+      transport_(transport),
+      model_proto_(*model_proto),
+      response_(response),
+      bounds_(bounds),
+      clauses_(clauses),
+      best_shared_objective_lb_(kMinIntegerValue.value()) {
+  if (bounds_ != nullptr) bounds_id_ = bounds_->RegisterNewId();
+  if (clauses_ != nullptr) {
+    clauses_id_ = clauses_->RegisterNewId(/*may_terminate_early=*/true);
+    clauses_->SetWorkerNameForId(clauses_id_, name());
+  }
+}
+
+void RemoteSharingHelper::Synchronize() {
+  std::string message;
+  while (transport_->Receive(&message)) {
+    ++num_messages_received_;
+    RemoteSharingProto proto;
+    if (!proto.ParseFromString(message)) {
+      ++num_rejected_updates_;
+      continue;
+    }
+    ProcessMessage(proto);
+  }
+  CollectLocalUpdates();
+  SendPendingUpdates();
+}
+
+void RemoteSharingHelper::CollectLocalUpdates() {
+  const SharedSolutionRepository<int64_t>& repository =
+      response_->SolutionsRepository();
+  if (repository.NumSolutions() > 0) {
+    const auto solution = repository.GetSolution(0);
+    if (!has_shared_solution_ || solution->rank < best_shared_rank_) {
+      has_shared_solution_ = true;
+      best_shared_rank_ = solution->rank;
+      pending_.mutable_solution()->Assign(solution->variable_values.begin(),
+                                          solution->variable_values.end());
+    }
+  }
+
+  if (model_proto_.has_objective()) {
+    const int64_t lb = response_->GetInnerObjectiveLowerBound().value();
+    if (lb > best_shared_objective_lb_) {
+      best_shared_objective_lb_ = lb;
+      pending_.set_objective_lower_bound(lb);
+    }
+  }
+
+  if (bounds_ != nullptr) {
+    bounds_->GetChangedBounds(bounds_id_, &variables_, &lower_bounds_,
+                              &upper_bounds_);
+    for (int i = 0; i < variables_.size(); ++i) {
+      const auto [it, inserted] = pending_bounds_.insert(
+          {variables_[i], {lower_bounds_[i], upper_bounds_[i]}});
+      if (!inserted) {
+        it->second.first = std::max(it->second.first, lower_bounds_[i]);
+        it->second.second = std::min(it->second.second, upper_bounds_[i]);
+      }
+    }
+  }
+
+  if (clauses_ != nullptr) {
+    clauses_->GetUnseenBinaryClauses(clauses_id_, &binary_clauses_);
+    for (const auto& clause : binary_clauses_) {
+      if (pending_binary_clauses_.size() >= kMaxPendingBinaryClauses) break;
+      pending_binary_clauses_.push_back(clause);
+    }
+
+    // We do not share the glue clauses, but we still need to consume them so
+    // that the manager can delete the batches seen by all the workers.
+    bool has_unseen_batch = true;
+    while (has_unseen_batch) {
+      has_unseen_batch = !clauses_->GetUnseenClauses(clauses_id_).empty();
+    }
+  }
+}
+
+void RemoteSharingHelper::SendPendingUpdates() {
+  RemoteSharingProto proto = pending_;
+  for (const auto& [var, bounds] : pending_bounds_) {
+    proto.add_bound_variables(var);
+    proto.add_lower_bounds(bounds.first);
+    proto.add_upper_bounds(bounds.second);
+  }
+  for (const auto [lit1, lit2] : pending_binary_clauses_) {
+    proto.add_binary_clause_literals(lit1);
+    proto.add_binary_clause_literals(lit2);
+  }
+
+  if (proto.ByteSizeLong() == 0) return;
+  proto.SerializeToString(&buffer_);
+
+  // If the message cannot be sent, we will retry with the next updates merged.
+  if (!transport_->Send(buffer_)) return;
+  ++num_messages_sent_;
+  pending_.Clear();
+  pending_bounds_.clear();
+  pending_binary_clauses_.clear();
+}
+
+bool RemoteSharingHelper::BoundsAreValid(int var, int64_t lb,
+                                         int64_t ub) const {
+  if (var < 0 || var >= model_proto_.variables_size()) return false;
+  if (lb > ub) return false;
+  const auto& domain = model_proto_.variables(var).domain();
+  if (domain.empty()) return false;
+  return lb >= domain[0] && ub <= domain[domain.size() - 1];
+}
+
+void RemoteSharingHelper::ProcessMessage(const RemoteSharingProto& message) {
+  if (message.solution_size() > 0) {
+    if (message.solution_size() == model_proto_.variables_size() &&
+        SolutionIsFeasible(model_proto_, message.solution())) {
+      const auto solution = response_->NewSolution(message.solution(), name());
+      if (!has_shared_solution_ || solution->rank < best_shared_rank_) {
+        has_shared_solution_ = true;
+        best_shared_rank_ = solution->rank;
+      }
+    } else {
+      ++num_rejected_updates_;
+    }
+  }
+
+  // A lower bound above the objective of a known solution is wrong, and would
+  // make us report this solution as optimal.
+  if (message.has_objective_lower_bound() && model_proto_.has_objective()) {
+    const int64_t lb = message.objective_lower_bound();
+    if (lb > response_->BestSolutionInnerObjectiveValue().value()) {
+      ++num_rejected_updates_;
+    } else {
+      if (lb > best_shared_objective_lb_) best_shared_objective_lb_ = lb;
+      response_->UpdateInnerObjectiveBounds(name(), IntegerValue(lb),
+                                            kMaxIntegerValue);
+    }
+  }
+
+  if (bounds_ != nullptr && message.bound_variables_size() > 0) {
+    const int num_bounds = message.bound_variables_size();
+    bool all_valid = message.lower_bounds_size() == num_bounds &&
+                     message.upper_bounds_size() == num_bounds;
+    for (int i = 0; all_valid && i < num_bounds; ++i) {
+      all_valid = BoundsAreValid(message.bound_variables(i),
+                                 message.lower_bounds(i),
+                                 message.upper_bounds(i));
+    }
+    if (all_valid) {
+      bounds_->ReportPotentialNewBounds(name(), message.bound_variables(),
+                                        message.lower_bounds(),
+                                        message.upper_bounds());
+    } else {
+      ++num_rejected_updates_;
+    }
+  }
+
+  // The clauses must only use Boolean variables.
+  const auto is_boolean_ref = [this](int ref) {
+    // Note that this also rejects INT_MIN, which has no positive counterpart.
+    if (ref < -model_proto_.variables_size()) return false;
+    if (ref >= model_proto_.variables_size()) return false;
+    const int var = PositiveRef(ref);
+    const auto& domain = model_proto_.variables(var).domain();
+    return !domain.empty() && domain[0] >= 0 && domain[domain.size() - 1] <= 1;
+  };
+  if (clauses_ != nullptr && message.binary_clause_literals_size() > 0) {
+    binary_clauses_.clear();
+    for (int i = 0; i + 1 < message.binary_clause_literals_size(); i += 2) {
+      const int lit1 = message.binary_clause_literals(i);
+      const int lit2 = message.binary_clause_literals(i + 1);
+      if (!is_boolean_ref(lit1) || !is_boolean_ref(lit2)) {
+        ++num_rejected_updates_;
+        continue;
+      }
+      binary_clauses_.push_back({lit1, lit2});
+    }
+    clauses_->AddBinaryClauses(clauses_id_, binary_clauses_);
+  }
+}
+
+}  // namespace sat
+}  // namespace operations_research
@@ -0,0 +1,214 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Classes to share the information found by the parallel CP-SAT search with
+// other processes solving the same model, possibly on other machines.
+//
+// Each process solves the model as usual, and registers a SharingTransport in
+// the Model passed to SolveCpModel(). The parallel search then exchanges, at
+// each synchronization, its new best solutions, level zero bounds, objective
+// lower bound and binary clauses with the process at the other end of the
+// transport. This is only done by the multi-thread search.
+//
+// Important: the shared information refers to the presolved model, so all the
+// processes must solve the same CpModelProto with the same presolve
+// parameters. The received solutions are checked before being used. The
+// received bounds, objective lower bound and clauses are only checked for
+// consistency with the model and with the best known solution, so they are
+// trusted: the peer must be too. There is no authentication, which is why the
+// TCP transport listens on the loopback interface by default.
+#ifndef OR_TOOLS_SAT_REMOTE_SHARING_H_
+#define OR_TOOLS_SAT_REMOTE_SHARING_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/container/btree_map.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/remote_sharing.pb.h"
+#include "ortools/sat/subsolver.h"
+#include "ortools/sat/synchronization.h"
+
+namespace operations_research {
+namespace sat {
+
+// A bidirectional and reliable channel of messages with another process. This
+// is only used by the main thread of the solver, so it does not need to be
+// thread-safe.
+class SharingTransport {
+ public:
+  virtual ~SharingTransport() = default;
+
+  // Queues the given message for sending. Returns false if the message was not
+  // queued, because the channel is broken or because too many bytes are still
+  // waiting to be sent. This must not block.
+  virtual bool Send(absl::string_view message) = 0;
+
+  // Returns true and fills the message if a complete message was received.
+  // Returns false if there is no such message yet, or if the channel is
+  // broken. This must not block.
+  virtual bool Receive(std::string* message) = 0;
+};
+
+// A SharingTransport over a connected stream socket. Each message is sent with
+// a 4 bytes little endian size prefix. This is only supported on POSIX
+// platforms, the factory functions return an error elsewhere.
+//
+// The socket is non-blocking: the bytes that cannot be written right away are
+// kept in a bounded buffer and written by the next calls to Send() or
+// Receive(). So a slow peer never stalls the solver, and two peers sending to
+// each other cannot deadlock.
+class SocketSharingTransport : public SharingTransport {
+ public:
+  // Maximum number of bytes waiting to be sent. Send() fails above that.
+  static constexpr int64_t kMaxPendingBytes = 16 << 20;
+
+  // Takes ownership of the given connected socket.
+  explicit SocketSharingTransport(int socket_fd);
+  ~SocketSharingTransport() override;
+
+  // This type is neither copyable nor movable.
+  SocketSharingTransport(const SocketSharingTransport&) = delete;
+  SocketSharingTransport& operator=(const SocketSharingTransport&) = delete;
+
+  // Returns two transports connected to each other, for tests.
+  static absl::StatusOr<std::pair<std::unique_ptr<SocketSharingTransport>,
+                                  std::unique_ptr<SocketSharingTransport>>>
+  CreatePair();
+
+  // Creates a Unix domain socket at the given path and waits for a peer
+  // process to connect to it.
+  static absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+  AcceptOnUnixSocket(const std::string& path);
+
+  // Connects to the Unix domain socket at the given path.
+  static absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+  ConnectToUnixSocket(const std::string& path);
+
+  // Listens on the given TCP port of the given local address and waits for a
+  // peer process to connect to it. Since anyone who can connect can make this
+  // process report a wrong result, only use an address reachable by other
+  // hosts, like "0.0.0.0", on a trusted network.
+  static absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+  AcceptOnTcpPort(int port, const std::string& bind_address = "127.0.0.1");
+
+  // Connects to the given TCP port of the given host.
+  static absl::StatusOr<std::unique_ptr<SocketSharingTransport>>
+  ConnectToTcpPort(const std::string& host, int port);
+
+  bool Send(absl::string_view message) final;
+  bool Receive(std::string* message) final;
+
+ private:
+  // Appends to buffer_ all the bytes that can be read without blocking.
+  // Returns false if the socket is closed or in error.
+  bool ReadAvailableBytes();
+
+  // Writes the bytes of send_buffer_ that can be written without blocking.
+  // Returns false if the socket is closed or in error.
+  bool WritePendingBytes();
+
+  int socket_fd_;
+  bool is_broken_ = false;
+
+  // The received bytes which are not yet returned by Receive().
+  std::string buffer_;
+
+  // The bytes to send are the ones of send_buffer_ after num_bytes_sent_.
+  std::string send_buffer_;
+  int64_t num_bytes_sent_ = 0;
+};
+
+// A helper SubSolver that exchanges the new solutions, level zero bounds,
+// objective lower bound and binary clauses found by this process with the
+// process at the other end of the transport, each time it is synchronized. It
+// never generates any task.
+//
+// If the transport cannot take a message, the updates are kept and merged with
+// the next ones: only the last solution, objective bound and variable bounds
+// are sent, and at most kMaxPendingBinaryClauses binary clauses are kept.
+class RemoteSharingHelper : public SubSolver {
+ public:
+  // The bounds and clauses managers can be null, in which case this
+  // information is not shared.
+  RemoteSharingHelper(SharingTransport* transport,
+                      const CpModelProto* model_proto,
+                      SharedResponseManager* response,
+                      SharedBoundsManager* bounds,
+                      SharedClausesManager* clauses);
+
+  bool TaskIsAvailable() final { return false; }
+  std::function<void()> GenerateTask(int64_t /*task_id*/) final {
+    return nullptr;
+  }
+  void Synchronize() final;
+
+  int64_t num_messages_sent() const { return num_messages_sent_; }
+  int64_t num_messages_received() const { return num_messages_received_; }
+
+  // The number of received messages, or parts of them, that were ignored
+  // because they are not consistent with the model or the best solution.
+  int64_t num_rejected_updates() const { return num_rejected_updates_; }
+
+  static constexpr int kMaxPendingBinaryClauses = 1 << 20;
+
+ private:
+  void CollectLocalUpdates();
+  void SendPendingUpdates();
+  void ProcessMessage(const RemoteSharingProto& message);
+
+  // Returns true if the given bounds can be applied to the given variable of
+  // the model.
+  bool BoundsAreValid(int var, int64_t lb, int64_t ub) const;
+
+  SharingTransport* transport_;
+  const CpModelProto& model_proto_;
+  SharedResponseManager* response_;
+  SharedBoundsManager* bounds_;
+  SharedClausesManager* clauses_;
+  int bounds_id_ = -1;
+  int clauses_id_ = -1;
+
+  // The rank of the best solution sent or received, to only send improving
+  // ones. Same for the objective lower bound.
+  bool has_shared_solution_ = false;
+  int64_t best_shared_rank_ = 0;
+  int64_t best_shared_objective_lb_;
+
+  std::vector<int> variables_;
+  std::vector<int64_t> lower_bounds_;
+  std::vector<int64_t> upper_bounds_;
+  std::vector<std::pair<int, int>> binary_clauses_;
+  std::string buffer_;
+
+  // The updates not sent yet. The solution and objective lower bound are in
+  // pending_, the bounds are merged per variable.
+  RemoteSharingProto pending_;
+  absl::btree_map<int, std::pair<int64_t, int64_t>> pending_bounds_;
+  std::vector<std::pair<int, int>> pending_binary_clauses_;
+
+  int64_t num_messages_sent_ = 0;
+  int64_t num_messages_received_ = 0;
+  int64_t num_rejected_updates_ = 0;
+};
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_REMOTE_SHARING_H_
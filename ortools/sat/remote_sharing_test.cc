@@ -0,0 +1,438 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/remote_sharing.h"
+
+#include <chrono>  // NOLINT
+#include <cstdint>
+#include <fstream>  // NOLINT
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+#include "ortools/base/gmock.h"
+#include "ortools/base/parse_test_proto.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/integer_base.h"
+#include "ortools/sat/model.h"
+#include "ortools/sat/remote_sharing.pb.h"
+#include "ortools/sat/synchronization.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+using ::google::protobuf::contrib::parse_proto::ParseTestProto;
+using ::testing::ElementsAre;
+
+#if !defined(_WIN32)
+
+TEST(SocketSharingTransportTest, MessagesAreReceivedInOrder) {
+  auto pair = SocketSharingTransport::CreatePair();
+  ASSERT_TRUE(pair.ok());
+  SocketSharingTransport* a = pair->first.get();
+  SocketSharingTransport* b = pair->second.get();
+
+  std::string message;
+  EXPECT_FALSE(b->Receive(&message));
+  EXPECT_TRUE(a->Send("hello"));
+  EXPECT_TRUE(a->Send(""));
+  EXPECT_TRUE(a->Send(std::string(100000, 'x')));
+
+  // The large message might not fit in the socket buffer, the rest is written
+  // by the next calls on a.
+  std::vector<std::string> received;
+  std::string unused;
+  while (received.size() < 3) {
+    EXPECT_FALSE(a->Receive(&unused));
+    if (b->Receive(&message)) received.push_back(message);
+  }
+  EXPECT_EQ(received[0], "hello");
+  EXPECT_EQ(received[1], "");
+  EXPECT_EQ(received[2], std::string(100000, 'x'));
+  EXPECT_FALSE(b->Receive(&message));
+}
+
+TEST(SocketSharingTransportTest, SendDoesNotBlockWhenPeerDoesNotRead) {
+  auto pair = SocketSharingTransport::CreatePair();
+  ASSERT_TRUE(pair.ok());
+  SocketSharingTransport* a = pair->first.get();
+  SocketSharingTransport* b = pair->second.get();
+
+  // Both sides send without reading, which would deadlock with blocking
+  // writes. The messages that do not fit in the send buffer are refused.
+  const std::string large(1 << 20, 'x');
+  const int num_messages = 2 * SocketSharingTransport::kMaxPendingBytes /
+                           static_cast<int64_t>(large.size());
+  int num_queued_by_a = 0;
+  int num_queued_by_b = 0;
+  for (int i = 0; i < num_messages; ++i) {
+    if (a->Send(large)) ++num_queued_by_a;
+    if (b->Send(large)) ++num_queued_by_b;
+  }
+  EXPECT_GT(num_queued_by_a, 0);
+  EXPECT_LT(num_queued_by_a, num_messages);
+  EXPECT_GT(num_queued_by_b, 0);
+  EXPECT_LT(num_queued_by_b, num_messages);
+
+  // All the queued messages are eventually received.
+  int num_received_by_a = 0;
+  int num_received_by_b = 0;
+  std::string message;
+  while (num_received_by_a < num_queued_by_b ||
+         num_received_by_b < num_queued_by_a) {
+    if (a->Receive(&message)) {
+      EXPECT_EQ(message.size(), large.size());
+      ++num_received_by_a;
+    }
+    if (b->Receive(&message)) {
+      EXPECT_EQ(message.size(), large.size());
+      ++num_received_by_b;
+    }
+  }
+  EXPECT_FALSE(a->Receive(&message));
+  EXPECT_FALSE(b->Receive(&message));
+}
+
+TEST(SocketSharingTransportTest, SendFailsWhenPeerIsClosed) {
+  auto pair = SocketSharingTransport::CreatePair();
+  ASSERT_TRUE(pair.ok());
+  pair->second.reset();
+  EXPECT_FALSE(pair->first->Send("hello"));
+  std::string message;
+  EXPECT_FALSE(pair->first->Receive(&message));
+}
+
+TEST(SocketSharingTransportTest, UnixSocket) {
+  const std::string path = ::testing::TempDir() + "/remote_sharing_test.sock";
+  absl::StatusOr<std::unique_ptr<SocketSharingTransport>> server;
+  std::thread server_thread([&server, &path]() {
+    server = SocketSharingTransport::AcceptOnUnixSocket(path);
+  });
+
+  // The server might not be listening yet.
+  absl::StatusOr<std::unique_ptr<SocketSharingTransport>> client;
+  for (int attempt = 0; attempt < 1000; ++attempt) {
+    client = SocketSharingTransport::ConnectToUnixSocket(path);
+    if (client.ok()) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_TRUE(client.ok());
+  server_thread.join();
+  ASSERT_TRUE(server.ok());
+
+  EXPECT_TRUE((*client)->Send("ping"));
+  std::string message;
+  while (!(*server)->Receive(&message)) {
+  }
+  EXPECT_EQ(message, "ping");
+}
+
+TEST(SocketSharingTransportTest, UnixSocketDoesNotRemoveRegularFile) {
+  const std::string path = ::testing::TempDir() + "/remote_sharing_test.txt";
+  std::ofstream(path) << "content";
+  EXPECT_FALSE(SocketSharingTransport::AcceptOnUnixSocket(path).ok());
+  EXPECT_TRUE(std::ifstream(path).good());
+}
+
+TEST(SocketSharingTransportTest, InvalidBindAddress) {
+  EXPECT_FALSE(
+      SocketSharingTransport::AcceptOnTcpPort(23456, "not an address").ok());
+}
+
+#endif  // !defined(_WIN32)
+
+// Sends and receives messages without any socket.
+class LoopbackTransport : public SharingTransport {
+ public:
+  void set_peer(LoopbackTransport* peer) { peer_ = peer; }
+
+  // When false, Send() refuses all the messages, like a full transport.
+  void set_accepts_messages(bool value) { accepts_messages_ = value; }
+
+  bool Send(absl::string_view message) final {
+    if (!accepts_messages_) return false;
+    peer_->messages_.push_back(std::string(message));
+    return true;
+  }
+
+  bool Receive(std::string* message) final {
+    if (messages_.empty()) return false;
+    *message = messages_.front();
+    messages_.erase(messages_.begin());
+    return true;
+  }
+
+ private:
+  LoopbackTransport* peer_ = nullptr;
+  bool accepts_messages_ = true;
+  std::vector<std::string> messages_;
+};
+
+const char kModel[] = R"pb(
+  variables { domain: [ 0, 10 ] }
+  variables { domain: [ 0, 10 ] }
+  constraints {
+    linear {
+      vars: [ 0, 1 ]
+      coeffs: [ 1, 1 ]
+      domain: [ 5, 20 ]
+    }
+  }
+  objective {
+    vars: [ 0, 1 ]
+    coeffs: [ 1, 2 ]
+  }
+)pb";
+
+TEST(RemoteSharingHelperTest, SolutionAndObjectiveBoundAreShared) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  Model model_a;
+  Model model_b;
+  auto* response_a = model_a.GetOrCreate<SharedResponseManager>();
+  auto* response_b = model_b.GetOrCreate<SharedResponseManager>();
+  response_a->InitializeObjective(model_proto);
+  response_b->InitializeObjective(model_proto);
+
+  LoopbackTransport transport_a;
+  LoopbackTransport transport_b;
+  transport_a.set_peer(&transport_b);
+  transport_b.set_peer(&transport_a);
+  RemoteSharingHelper helper_a(&transport_a, &model_proto, response_a,
+                               /*bounds=*/nullptr, /*clauses=*/nullptr);
+  RemoteSharingHelper helper_b(&transport_b, &model_proto, response_b,
+                               /*bounds=*/nullptr, /*clauses=*/nullptr);
+
+  response_a->NewSolution({5, 0}, "test");
+  response_a->UpdateInnerObjectiveBounds("test", IntegerValue(3),
+                                         IntegerValue(10));
+  response_a->Synchronize();
+  response_a->MutableSolutionsRepository()->Synchronize();
+  helper_a.Synchronize();
+  EXPECT_EQ(helper_a.num_messages_sent(), 1);
+
+  helper_b.Synchronize();
+  response_b->Synchronize();
+  response_b->MutableSolutionsRepository()->Synchronize();
+  EXPECT_EQ(helper_b.num_messages_received(), 1);
+  EXPECT_EQ(response_b->BestSolutionInnerObjectiveValue(), IntegerValue(5));
+  EXPECT_EQ(response_b->GetInnerObjectiveLowerBound(), IntegerValue(3));
+
+  // Nothing new is sent back.
+  EXPECT_EQ(helper_b.num_messages_sent(), 0);
+}
+
+TEST(RemoteSharingHelperTest, InfeasibleSolutionIsIgnored) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  Model model;
+  auto* response = model.GetOrCreate<SharedResponseManager>();
+  response->InitializeObjective(model_proto);
+
+  LoopbackTransport transport;
+  LoopbackTransport remote;
+  transport.set_peer(&remote);
+  remote.set_peer(&transport);
+  RemoteSharingHelper helper(&transport, &model_proto, response,
+                             /*bounds=*/nullptr, /*clauses=*/nullptr);
+
+  RemoteSharingProto message;
+  message.add_solution(1);
+  message.add_solution(1);
+  remote.Send(message.SerializeAsString());
+  helper.Synchronize();
+  response->MutableSolutionsRepository()->Synchronize();
+  EXPECT_EQ(helper.num_messages_received(), 1);
+  EXPECT_EQ(helper.num_rejected_updates(), 1);
+  EXPECT_EQ(response->SolutionsRepository().NumSolutions(), 0);
+}
+
+TEST(RemoteSharingHelperTest, InvalidUpdatesAreRejected) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  Model model;
+  auto* response = model.GetOrCreate<SharedResponseManager>();
+  response->InitializeObjective(model_proto);
+  SharedBoundsManager bounds(model_proto);
+  SharedClausesManager clauses(/*always_synchronize=*/true);
+
+  LoopbackTransport transport;
+  LoopbackTransport remote;
+  transport.set_peer(&remote);
+  remote.set_peer(&transport);
+  RemoteSharingHelper helper(&transport, &model_proto, response, &bounds,
+                             &clauses);
+  const int reader_bounds_id = bounds.RegisterNewId();
+  const int reader_clauses_id =
+      clauses.RegisterNewId(/*may_terminate_early=*/false);
+  response->NewSolution({5, 0}, "test");
+
+  // Unknown variable, empty interval and bounds outside of the domain.
+  RemoteSharingProto message;
+  message.add_bound_variables(2);
+  message.add_lower_bounds(0);
+  message.add_upper_bounds(1);
+  remote.Send(message.SerializeAsString());
+  message.Clear();
+  message.add_bound_variables(0);
+  message.add_lower_bounds(5);
+  message.add_upper_bounds(4);
+  remote.Send(message.SerializeAsString());
+  message.Clear();
+  message.add_bound_variables(1);
+  message.add_lower_bounds(-1);
+  message.add_upper_bounds(4);
+  remote.Send(message.SerializeAsString());
+
+  // The objective lower bound is above the known solution.
+  message.Clear();
+  message.set_objective_lower_bound(6);
+  remote.Send(message.SerializeAsString());
+
+  // The clause uses a non-Boolean variable.
+  message.Clear();
+  message.add_binary_clause_literals(0);
+  message.add_binary_clause_literals(-2);
+  remote.Send(message.SerializeAsString());
+
+  // The clause uses an invalid literal.
+  message.Clear();
+  message.add_binary_clause_literals(std::numeric_limits<int>::min());
+  message.add_binary_clause_literals(-1);
+  remote.Send(message.SerializeAsString());
+
+  // Not a RemoteSharingProto.
+  remote.Send("\xff\xff\xff");
+
+  helper.Synchronize();
+  bounds.Synchronize();
+  clauses.Synchronize();
+  EXPECT_EQ(helper.num_messages_received(), 7);
+  EXPECT_EQ(helper.num_rejected_updates(), 7);
+  EXPECT_LE(response->GetInnerObjectiveLowerBound(), IntegerValue(5));
+
+  std::vector<int> variables;
+  std::vector<int64_t> lower_bounds;
+  std::vector<int64_t> upper_bounds;
+  bounds.GetChangedBounds(reader_bounds_id, &variables, &lower_bounds,
+                          &upper_bounds);
+  EXPECT_TRUE(variables.empty());
+  std::vector<std::pair<int, int>> binary_clauses;
+  clauses.GetUnseenBinaryClauses(reader_clauses_id, &binary_clauses);
+  EXPECT_TRUE(binary_clauses.empty());
+}
+
+TEST(RemoteSharingHelperTest, UpdatesAreMergedWhenTheTransportIsFull) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  Model model_a;
+  Model model_b;
+  auto* response_a = model_a.GetOrCreate<SharedResponseManager>();
+  auto* response_b = model_b.GetOrCreate<SharedResponseManager>();
+  response_a->InitializeObjective(model_proto);
+  response_b->InitializeObjective(model_proto);
+  SharedBoundsManager bounds_a(model_proto);
+  SharedBoundsManager bounds_b(model_proto);
+
+  LoopbackTransport transport_a;
+  LoopbackTransport transport_b;
+  transport_a.set_peer(&transport_b);
+  transport_b.set_peer(&transport_a);
+  RemoteSharingHelper helper_a(&transport_a, &model_proto, response_a,
+                               &bounds_a, /*clauses=*/nullptr);
+  RemoteSharingHelper helper_b(&transport_b, &model_proto, response_b,
+                               &bounds_b, /*clauses=*/nullptr);
+  const int reader_bounds_id = bounds_b.RegisterNewId();
+
+  transport_a.set_accepts_messages(false);
+  bounds_a.ReportPotentialNewBounds("test", {0}, {2}, {8});
+  bounds_a.Synchronize();
+  helper_a.Synchronize();
+  bounds_a.ReportPotentialNewBounds("test", {0, 1}, {3, 1}, {9, 9});
+  bounds_a.Synchronize();
+  helper_a.Synchronize();
+  EXPECT_EQ(helper_a.num_messages_sent(), 0);
+
+  // Everything is sent in one message once the transport accepts it again.
+  transport_a.set_accepts_messages(true);
+  helper_a.Synchronize();
+  EXPECT_EQ(helper_a.num_messages_sent(), 1);
+  helper_b.Synchronize();
+  bounds_b.Synchronize();
+  EXPECT_EQ(helper_b.num_messages_received(), 1);
+
+  std::vector<int> variables;
+  std::vector<int64_t> lower_bounds;
+  std::vector<int64_t> upper_bounds;
+  bounds_b.GetChangedBounds(reader_bounds_id, &variables, &lower_bounds,
+                            &upper_bounds);
+  EXPECT_THAT(variables, ElementsAre(0, 1));
+  EXPECT_THAT(lower_bounds, ElementsAre(3, 1));
+  EXPECT_THAT(upper_bounds, ElementsAre(8, 9));
+}
+
+TEST(RemoteSharingHelperTest, BoundsAndBinaryClausesAreShared) {
+  const CpModelProto model_proto = ParseTestProto(kModel);
+  Model model_a;
+  Model model_b;
+  auto* response_a = model_a.GetOrCreate<SharedResponseManager>();
+  auto* response_b = model_b.GetOrCreate<SharedResponseManager>();
+  response_a->InitializeObjective(model_proto);
+  response_b->InitializeObjective(model_proto);
+  SharedBoundsManager bounds_a(model_proto);
+  SharedBoundsManager bounds_b(model_proto);
+  SharedClausesManager clauses_a(/*always_synchronize=*/true);
+  SharedClausesManager clauses_b(/*always_synchronize=*/true);
+
+  LoopbackTransport transport_a;
+  LoopbackTransport transport_b;
+  transport_a.set_peer(&transport_b);
+  transport_b.set_peer(&transport_a);
+  RemoteSharingHelper helper_a(&transport_a, &model_proto, response_a,
+                               &bounds_a, &clauses_a);
+  RemoteSharingHelper helper_b(&transport_b, &model_proto, response_b,
+                               &bounds_b, &clauses_b);
+  const int reader_bounds_id = bounds_b.RegisterNewId();
+  const int writer_clauses_id =
+      clauses_a.RegisterNewId(/*may_terminate_early=*/false);
+  const int reader_clauses_id =
+      clauses_b.RegisterNewId(/*may_terminate_early=*/false);
+
+  bounds_a.ReportPotentialNewBounds("test", {0}, {2}, {8});
+  bounds_a.Synchronize();
+  clauses_a.AddBinaryClause(writer_clauses_id, 0, -2);
+  clauses_a.Synchronize();
+  helper_a.Synchronize();
+  helper_b.Synchronize();
+  bounds_b.Synchronize();
+  clauses_b.Synchronize();
+
+  std::vector<int> variables;
+  std::vector<int64_t> lower_bounds;
+  std::vector<int64_t> upper_bounds;
+  bounds_b.GetChangedBounds(reader_bounds_id, &variables, &lower_bounds,
+                            &upper_bounds);
+  EXPECT_THAT(variables, ElementsAre(0));
+  EXPECT_THAT(lower_bounds, ElementsAre(2));
+  EXPECT_THAT(upper_bounds, ElementsAre(8));
+
+  std::vector<std::pair<int, int>> clauses;
+  clauses_b.GetUnseenBinaryClauses(reader_clauses_id, &clauses);
+  EXPECT_THAT(clauses, ElementsAre(std::make_pair(-2, 0)));
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <utility>
 #include <vector>
@@ -27,6 +28,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/span.h"
 #include "ortools/base/logging.h"
+#include "ortools/base/threadpool.h"
 #include "ortools/sat/boolean_problem.pb.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/util/filelineiter.h"
@@ -156,6 +158,16 @@ class SatCnfReader {
   // problem: Try to minimize the number of unsatisfiable clauses.
   void InterpretCnfAsMaxSat(bool v) { interpret_cnf_as_max_sat_ = v; }
 
+  // If more than one, the whole file is read in memory and split in chunks of
+  // lines that are tokenized in parallel. Only the tokenization is parallel,
+  // the clauses are still added in the file order so the result is the same.
+  void SetNumParsingThreads(int num_threads) {
+    num_parsing_threads_ = std::max(num_threads, 1);
+  }
+
+  // The number of (uncompressed) bytes read by the last Load().
+  int64_t num_bytes_read() const { return num_bytes_read_; }
+
   // Loads the given cnf filename into the given proto.
   bool Load(const std::string& filename, LinearBooleanProblem* problem) {
     problem->Clear();
@@ -176,6 +188,7 @@ class SatCnfReader {
     is_wcnf_ = false;
     objective_offset_ = 0;
     positive_literal_to_weight_.clear();
+    slack_literal_to_weight_.clear();
 
     end_marker_seen_ = false;
     hard_weight_ = 0;
@@ -187,14 +200,20 @@ class SatCnfReader {
     num_variables_ = 0;
     num_clauses_ = 0;
     actual_num_variables_ = 0;
+    num_bytes_read_ = 0;
 
-    int num_lines = 0;
-    for (const std::string& line : FileLines(filename)) {
-      ++num_lines;
-      ProcessNewLine(line, problem);
-    }
-    if (num_lines == 0) {
-      LOG(FATAL) << "File '" << filename << "' is empty or can't be read.";
+    if (num_parsing_threads_ > 1) {
+      LoadInParallel(filename, problem);
+    } else {
+      int num_lines = 0;
+      for (const std::string& line : FileLines(filename)) {
+        ++num_lines;
+        num_bytes_read_ += line.size() + 1;
+        ProcessNewLine(line, problem);
+      }
+      if (num_lines == 0) {
+        LOG(FATAL) << "File '" << filename << "' is empty or can't be read.";
+      }
     }
 
     if (num_variables_ > 0 && num_variables_ != actual_num_variables_) {
@@ -240,7 +259,102 @@ class SatCnfReader {
     return problem_name;
   }
 
-  void ProcessHeader(const std::string& line) {
+  // The lines of a chunk of the file, in order. The integers of a clause line
+  // are in tokens[begin, end), see TokenizeClauseLine(). The other lines are
+  // kept as text: header, end marker, and lines that cannot be tokenized. The
+  // later can appear after the end marker, so they must only be an error if
+  // they are processed.
+  struct TokenizedChunk {
+    struct Line {
+      absl::string_view text;
+      int64_t begin = 0;
+      int64_t end = 0;
+      bool starts_with_h = false;
+    };
+    std::vector<Line> lines;
+    std::vector<int64_t> tokens;
+  };
+
+  template <class Problem>
+  void LoadInParallel(const std::string& filename, Problem* problem) {
+    std::string content;
+    if (!ReadFileContent(filename, &content) || content.empty()) {
+      LOG(FATAL) << "File '" << filename << "' is empty or can't be read.";
+    }
+    num_bytes_read_ = content.size();
+
+    const std::vector<absl::string_view> chunks =
+        SplitIntoLineChunks(content, num_parsing_threads_);
+    std::vector<TokenizedChunk> tokenized_chunks(chunks.size());
+    {
+      ThreadPool pool(num_parsing_threads_);
+      pool.StartWorkers();
+      for (int i = 0; i < chunks.size(); ++i) {
+        pool.Schedule([&chunks, &tokenized_chunks, i]() {
+          TokenizeChunk(chunks[i], &tokenized_chunks[i]);
+        });
+      }
+    }
+
+    for (const TokenizedChunk& chunk : tokenized_chunks) {
+      const absl::Span<const int64_t> tokens = chunk.tokens;
+      for (const TokenizedChunk::Line& line : chunk.lines) {
+        if (end_marker_seen_) return;
+        if (!line.text.empty()) {
+          ProcessNewLine(line.text, problem);
+        } else {
+          ProcessClause(tokens.subspan(line.begin, line.end - line.begin),
+                        line.starts_with_h, problem);
+        }
+      }
+    }
+  }
+
+  static void TokenizeChunk(absl::string_view chunk, TokenizedChunk* result) {
+    for (const absl::string_view line : absl::StrSplit(chunk, '\n')) {
+      if (line.empty() || line[0] == 'c') continue;
+      TokenizedChunk::Line& new_line = result->lines.emplace_back();
+      if (line[0] == '%' || line[0] == 'p') {
+        new_line.text = line;
+        continue;
+      }
+      new_line.begin = result->tokens.size();
+      if (!TokenizeClauseLine(line, &result->tokens, &new_line.starts_with_h)) {
+        result->tokens.resize(new_line.begin);
+        new_line.text = line;
+        continue;
+      }
+      new_line.end = result->tokens.size();
+    }
+  }
+
+  // Appends to tokens the integers of the given clause line, up to and
+  // including the first zero. Nothing after it is used by ProcessClause(). A
+  // first word "h" marks a hard clause in the 2022 wcnf format, it is not
+  // added to tokens. Returns false if a word is not an integer.
+  static bool TokenizeClauseLine(absl::string_view line,
+                                 std::vector<int64_t>* tokens,
+                                 bool* starts_with_h) {
+    *starts_with_h = false;
+    bool first = true;
+    for (const absl::string_view word :
+         absl::StrSplit(line, ' ', absl::SkipEmpty())) {
+      if (first) {
+        first = false;
+        if (word == "h") {
+          *starts_with_h = true;
+          continue;
+        }
+      }
+      int64_t value;
+      if (!absl::SimpleAtoi(word, &value)) return false;
+      tokens->push_back(value);
+      if (value == 0) return true;
+    }
+    return true;
+  }
+
+  void ProcessHeader(absl::string_view line) {
     static const char kWordDelimiters[] = " ";
     words_ = absl::StrSplit(line, kWordDelimiters, absl::SkipEmpty());
 
@@ -261,7 +375,7 @@ class SatCnfReader {
   }
 
   template <class Problem>
-  void ProcessNewLine(const std::string& line, Problem* problem) {
+  void ProcessNewLine(absl::string_view line, Problem* problem) {
     if (line.empty() || end_marker_seen_) return;
     if (line[0] == 'c') return;
     if (line[0] == '%') {
@@ -273,46 +387,50 @@ class SatCnfReader {
       return;
     }
 
+    tmp_tokens_.clear();
+    bool starts_with_h;
+    CHECK(TokenizeClauseLine(line, &tmp_tokens_, &starts_with_h)) << line;
+    ProcessClause(tmp_tokens_, starts_with_h, problem);
+  }
+
+  // Processes a clause line given by its tokens, see TokenizeClauseLine().
+  template <class Problem>
+  void ProcessClause(absl::Span<const int64_t> tokens, bool starts_with_h,
+                     Problem* problem) {
     // The new wcnf format do not have header p line anymore.
     if (num_variables_ == 0) {
       is_wcnf_ = true;
     }
-
-    static const char kWordDelimiters[] = " ";
-    auto splitter = absl::StrSplit(line, kWordDelimiters, absl::SkipEmpty());
+    CHECK(is_wcnf_ || !starts_with_h) << "Hard clause marker in a cnf file.";
 
     tmp_clause_.clear();
     int64_t weight =
         (!is_wcnf_ && interpret_cnf_as_max_sat_) ? 1 : hard_weight_;
-    bool first = true;
-    bool end_marker_seen = false;
-    for (const absl::string_view word : splitter) {
-      if (first && is_wcnf_) {
-        first = false;
-        if (word == "h") {
-          // Hard clause in the new 2022 format.
-          // Note that hard_weight_ == 0 here.
-          weight = hard_weight_;
-        } else {
-          CHECK(absl::SimpleAtoi(word, &weight));
-          CHECK_GE(weight, 0);
-
-          // A soft clause of weight 0 can be removed.
-          if (weight == 0) {
-            ++num_skipped_soft_clauses_;
-            return;
-          }
-        }
-        continue;
+    int index = 0;
+    if (is_wcnf_ && !starts_with_h) {
+      // Soft clause, or hard clause with the old format weight.
+      // Note that for a hard clause in the new 2022 format (starts_with_h),
+      // hard_weight_ == 0 and this is the weight we already have.
+      if (tokens.empty()) return;
+      weight = tokens[0];
+      CHECK_GE(weight, 0);
+
+      // A soft clause of weight 0 can be removed.
+      if (weight == 0) {
+        ++num_skipped_soft_clauses_;
+        return;
       }
-
-      int signed_value;
-      CHECK(absl::SimpleAtoi(word, &signed_value));
-      if (signed_value == 0) {
+      index = 1;
+    }
+    bool end_marker_seen = false;
+    for (; index < tokens.size(); ++index) {
+      if (tokens[index] == 0) {
         end_marker_seen = true;
         break;  // end of clause.
       }
-
+      CHECK_GE(tokens[index], std::numeric_limits<int>::min());
+      CHECK_LE(tokens[index], std::numeric_limits<int>::max());
+      const int signed_value = static_cast<int>(tokens[index]);
       actual_num_variables_ = std::max(actual_num_variables_,
                                        std::max(signed_value, -signed_value));
       tmp_clause_.push_back(signed_value);
@@ -361,6 +479,8 @@ class SatCnfReader {
 
   bool interpret_cnf_as_max_sat_;
   const bool wcnf_use_strong_slack_;
+  int num_parsing_threads_ = 1;
+  int64_t num_bytes_read_ = 0;
 
   int num_clauses_ = 0;
   int num_variables_ = 0;
@@ -386,6 +506,7 @@ class SatCnfReader {
   int num_singleton_soft_clauses_;
   int num_added_clauses_;
 
+  std::vector<int64_t> tmp_tokens_;
   std::vector<int> tmp_clause_;
 };
 
@@ -13,6 +13,7 @@
 
 #include "ortools/sat/sat_cnf_reader.h"
 
+#include <cstdint>
 #include <string>
 
 #include "absl/log/check.h"
@@ -163,6 +164,38 @@ TEST(SatCnfReader, WcnfNewFormat) {
   EXPECT_EQ(file_content, LinearBooleanProblemToCnfString(problem));
 }
 
+TEST(SatCnfReader, ParallelParsingGivesTheSameProblem) {
+  std::string file_content =
+      "c A comment.\n"
+      "p wcnf 30 0 1000\n";
+  for (int i = 1; i <= 200; ++i) {
+    const int a = 1 + i % 30;
+    const int b = 1 + (7 * i) % 30;
+    if (i % 5 == 0) {
+      absl::StrAppend(&file_content, "c clause ", i, "\n");
+    }
+    const int weight = i % 3 == 0 ? 1000 : i % 4;
+    absl::StrAppend(&file_content, weight, " ", a, " -", b, " 0\n");
+  }
+  absl::StrAppend(&file_content, "%\n0\n");
+  const std::string filename = WriteTmpFileOrDie(file_content);
+
+  SatCnfReader reader;
+  LinearBooleanProblem expected;
+  EXPECT_TRUE(reader.Load(filename, &expected));
+  EXPECT_EQ(reader.num_bytes_read(),
+            static_cast<int64_t>(file_content.size()));
+  for (const int num_threads : {2, 3, 8, 100}) {
+    reader.SetNumParsingThreads(num_threads);
+    LinearBooleanProblem problem;
+    EXPECT_TRUE(reader.Load(filename, &problem));
+    EXPECT_EQ(reader.num_bytes_read(),
+              static_cast<int64_t>(file_content.size()));
+    EXPECT_EQ(LinearBooleanProblemToCnfString(expected),
+              LinearBooleanProblemToCnfString(problem));
+  }
+}
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
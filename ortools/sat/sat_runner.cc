@@ -16,6 +16,7 @@
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -26,6 +27,7 @@
 #include "absl/log/flags.h"
 #include "absl/log/initialize.h"
 #include "absl/log/log.h"
+#include "absl/status/statusor.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_split.h"
@@ -35,7 +37,9 @@
 #include "ortools/base/helpers.h"
 #include "ortools/base/options.h"
 #include "ortools/base/path.h"
+#include "ortools/base/timer.h"
 #include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_columnar.h"
 #include "ortools/sat/cp_model_solver.h"
 #include "ortools/sat/cp_model_utils.h"
 #include "ortools/sat/model.h"
@@ -51,7 +55,8 @@ ABSL_FLAG(
     std::string, input, "",
     "Required: input file of the problem to solve. Many format are supported:"
     ".cnf (sat, max-sat, weighted max-sat), .opb (pseudo-boolean sat/optim) "
-    "and by default the CpModelProto proto (binary or text).");
+    "and by default the CpModelProto proto (binary or text). The columnar "
+    "format of cp_model_columnar.h is used for the .cpcol files.");
 
 ABSL_FLAG(
     std::string, hint_file, "",
@@ -79,6 +84,11 @@ ABSL_FLAG(bool, competition_mode, false,
           "If true, output the log in a competition format.");
 ABSL_FLAG(bool, force_interleave_search, false,
           "If true, enable interleaved workers when num_workers is 1.");
+ABSL_FLAG(int, num_parsing_threads, 1,
+          "Number of threads used to parse the .cnf and .opb files. The result "
+          "does not depend on it.");
+ABSL_FLAG(bool, benchmark_loading, false,
+          "If true, only load the input and report the loading throughput.");
 
 namespace operations_research {
 namespace sat {
@@ -184,16 +194,24 @@ void SetInterleavedWorkers(SatParameters* parameters) {
   }
 }
 
+// Fills num_bytes_read with the size of the parsed text for the .cnf and .opb
+// files, with the file size for the .cpcol files, and with zero for the other
+// formats.
 bool LoadProblem(const std::string& filename, absl::string_view hint_file,
                  absl::string_view domain_file, CpModelProto* cp_model,
-                 Model* model, SatParameters* parameters) {
+                 Model* model, SatParameters* parameters,
+                 int64_t* num_bytes_read) {
+  *num_bytes_read = 0;
   if (absl::EndsWith(filename, ".opb") ||
       absl::EndsWith(filename, ".opb.bz2") ||
       absl::EndsWith(filename, ".opb.gz") || absl::EndsWith(filename, ".wbo") ||
       absl::EndsWith(filename, ".wbo.bz2") ||
       absl::EndsWith(filename, ".wbo.gz")) {
     OpbReader reader;
-    if (!reader.LoadAndValidate(filename, cp_model)) {
+    reader.SetNumParsingThreads(absl::GetFlag(FLAGS_num_parsing_threads));
+    const bool loaded = reader.LoadAndValidate(filename, cp_model);
+    *num_bytes_read = reader.num_bytes_read();
+    if (!loaded) {
       if (!reader.model_is_supported()) {  // Some constants are too large.
         if (absl::GetFlag(FLAGS_competition_mode)) {
           // We output the official UNSUPPORTED status.
@@ -235,9 +253,18 @@ bool LoadProblem(const std::string& filename, absl::string_view hint_file,
              absl::EndsWith(filename, ".wcnf.xz") ||
              absl::EndsWith(filename, ".wcnf.gz")) {
     SatCnfReader reader(absl::GetFlag(FLAGS_wcnf_use_strong_slack));
+    reader.SetNumParsingThreads(absl::GetFlag(FLAGS_num_parsing_threads));
     if (!reader.Load(filename, cp_model)) {
       LOG(FATAL) << "Cannot load file '" << filename << "'.";
     }
+    *num_bytes_read = reader.num_bytes_read();
+  } else if (absl::EndsWith(filename, ".cpcol")) {
+    // The model is built directly from the mapped file, without parsing.
+    absl::StatusOr<std::unique_ptr<CpModelColumnarFile>> file =
+        CpModelColumnarFile::Open(filename);
+    CHECK_OK(file.status());
+    (*file)->view().FillCpModelProto(cp_model);
+    *num_bytes_read = (*file)->size_in_bytes();
   } else {
     CHECK_OK(ReadFileToProto(filename, cp_model));
   }
@@ -310,14 +337,30 @@ int Run() {
   google::protobuf::Arena arena;
   CpModelProto* cp_model =
       google::protobuf::Arena::Create<CpModelProto>(&arena);
+  WallTimer load_timer;
+  load_timer.Start();
+  int64_t num_bytes_read = 0;
   if (!LoadProblem(absl::GetFlag(FLAGS_input), absl::GetFlag(FLAGS_hint_file),
                    absl::GetFlag(FLAGS_domain_file), cp_model, &model,
-                   &parameters)) {
+                   &parameters, &num_bytes_read)) {
     if (!absl::GetFlag(FLAGS_competition_mode)) {
       LOG(FATAL) << "Cannot load file '" << absl::GetFlag(FLAGS_input) << "'.";
     }
     return EXIT_SUCCESS;
   }
+  load_timer.Stop();
+  if (absl::GetFlag(FLAGS_benchmark_loading)) {
+    const double seconds = load_timer.Get();
+    const double megabytes = static_cast<double>(num_bytes_read) / 1e6;
+    std::cout << absl::StrFormat(
+                     "Loaded %.2f MB in %.3fs (%.2f MB/s), %d variables, %d "
+                     "constraints.",
+                     megabytes, seconds,
+                     seconds > 0.0 ? megabytes / seconds : 0.0,
+                     cp_model->variables_size(), cp_model->constraints_size())
+              << std::endl;
+    return EXIT_SUCCESS;
+  }
 
   model.Add(NewSatParameters(parameters));
   if (absl::GetFlag(FLAGS_fingerprint_intermediate_solutions)) {
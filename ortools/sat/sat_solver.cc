@@ -212,6 +212,9 @@ bool SatSolver::AddProblemClause(absl::Span<const Literal> literals) {
   SCOPED_TIME_STAT(&stats_);
   DCHECK_EQ(CurrentDecisionLevel(), 0);
   if (model_is_unsat_) return false;
+  const ClauseId lrat_id = lrat_proof_handler_ != nullptr
+                               ? lrat_proof_handler_->AddProblemClause(literals)
+                               : kNoClauseId;
 
   // Filter already assigned literals. Note that we also remap literal in case
   // we discovered equivalence later in the search.
@@ -231,6 +234,23 @@ bool SatSolver::AddProblemClause(absl::Span<const Literal> literals) {
     }
   }
 
+  // The filtered clause follows from the original one and from the unit
+  // clauses of its false literals.
+  if (lrat_proof_handler_ != nullptr &&
+      literals_scratchpad_.size() < literals.size()) {
+    ProcessNewlyFixedVariablesForLratProof();
+    lrat_hints_.clear();
+    lrat_is_marked_.ClearAndResize(num_variables_);
+    for (const Literal l : literals) {
+      if (!trail_->Assignment().LiteralIsFalse(l)) continue;
+      if (lrat_is_marked_[l.Variable()]) continue;
+      lrat_is_marked_.Set(l.Variable());
+      lrat_hints_.push_back(lrat_unit_ids_[l.Variable().value()]);
+    }
+    lrat_hints_.push_back(lrat_id);
+    lrat_proof_handler_->AddInferedClause(literals_scratchpad_, lrat_hints_);
+  }
+
   return AddProblemClauseInternal(literals_scratchpad_);
 }
 
@@ -273,6 +293,10 @@ bool SatSolver::AddProblemClauseInternal(absl::Span<const Literal> literals) {
   // tigger computation (like the LP) even if no domain changed since the last
   // call. We do not want to do that.
   if (!PropagationIsDone() && !Propagate()) {
+    if (lrat_proof_handler_ != nullptr) {
+      ComputeLratHints({}, &lrat_hints_);
+      lrat_proof_handler_->AddInferedClause({}, lrat_hints_);
+    }
     return SetModelUnsat();
   }
   return true;
@@ -708,7 +732,13 @@ void SatSolver::ProcessCurrentConflict() {
                           &subsumed_clauses_);
 
   // An empty conflict means that the problem is UNSAT.
-  if (learned_conflict_.empty()) return (void)SetModelUnsat();
+  if (learned_conflict_.empty()) {
+    if (lrat_proof_handler_ != nullptr) {
+      ComputeLratHints({}, &lrat_hints_);
+      lrat_proof_handler_->AddInferedClause({}, lrat_hints_);
+    }
+    return (void)SetModelUnsat();
+  }
   DCHECK(IsConflictValid(learned_conflict_));
   DCHECK(ClauseIsValidUnderDebugAssignment(learned_conflict_));
 
@@ -750,7 +780,7 @@ void SatSolver::ProcessCurrentConflict() {
   // There is no point using this if the conflict and all the reasons involved
   // in its resolution were clauses.
   bool compute_pb_conflict = false;
-  if (parameters_->use_pb_resolution()) {
+  if (parameters_->use_pb_resolution() && lrat_proof_handler_ == nullptr) {
     compute_pb_conflict = (pb_constraints_->ConflictingConstraint() != nullptr);
     if (!compute_pb_conflict) {
       for (Literal lit : reason_used_to_infer_the_conflict_) {
@@ -851,8 +881,13 @@ void SatSolver::ProcessCurrentConflict() {
   // this way. Second, more variables may be marked (in is_marked_) and
   // MinimizeConflict() can take advantage of that. Because of this, the
   // LBD of the learned conflict can change.
+  //
+  // The LRAT hints are computed from the trail reasons, which these
+  // minimizations do not follow, so they are disabled in this case.
   DCHECK(ClauseIsValidUnderDebugAssignment(learned_conflict_));
-  if (!binary_implication_graph_->IsEmpty()) {
+  const bool use_binary_minimization =
+      !binary_implication_graph_->IsEmpty() && lrat_proof_handler_ == nullptr;
+  if (use_binary_minimization) {
     if (parameters_->binary_minimization_algorithm() ==
         SatParameters::BINARY_MINIMIZATION_FIRST) {
       binary_implication_graph_->MinimizeConflictFirst(
@@ -871,7 +906,7 @@ void SatSolver::ProcessCurrentConflict() {
   MinimizeConflict(&learned_conflict_);
 
   // Minimize it further with binary clauses?
-  if (!binary_implication_graph_->IsEmpty()) {
+  if (use_binary_minimization) {
     // Note that on the contrary to the MinimizeConflict() above that
     // just uses the reason graph, this minimization can change the
     // clause LBD and even the backtracking level.
@@ -904,6 +939,13 @@ void SatSolver::ProcessCurrentConflict() {
   // current conflicting literal.
   decision_policy_->BeforeConflict(trail_->Index());
 
+  // The LRAT hints must be computed before backtracking, while the reasons of
+  // the literals used to infer the conflict are still available.
+  if (lrat_proof_handler_ != nullptr) {
+    ComputeLratHints(learned_conflict_, &lrat_hints_);
+    lrat_proof_handler_->AddInferedClause(learned_conflict_, lrat_hints_);
+  }
+
   // Backtrack and add the reason to the set of learned clause.
   counters_.num_literals_learned += learned_conflict_.size();
   Backtrack(ComputeBacktrackLevel(learned_conflict_));
@@ -1501,6 +1543,10 @@ SatSolver::Status SatSolver::SolveInternal(TimeLimit* time_limit,
 bool SatSolver::MinimizeByPropagation(double dtime,
                                       bool minimize_new_clauses_only) {
   CHECK(time_limit_ != nullptr);
+
+  // TODO(user): Produce the LRAT hints of the minimized clauses.
+  if (lrat_proof_handler_ != nullptr) return !model_is_unsat_;
+
   AdvanceDeterministicTime(time_limit_);
   const double threshold = time_limit_->GetElapsedDeterministicTime() + dtime;
 
@@ -1773,6 +1819,8 @@ std::string SatSolver::StatusString(Status status) const {
                          clauses_propagator_->num_inspected_clauses()) +
          absl::StrFormat("  num inspected clause_literals: %d\n",
                          clauses_propagator_->num_inspected_clause_literals()) +
+         absl::StrFormat("  num ternary inline skips: %d\n",
+                         clauses_propagator_->num_ternary_inline_skips()) +
          absl::StrFormat(
              "  num learned literals: %d  (avg: %.1f /clause)\n",
              counters_.num_literals_learned,
@@ -1839,6 +1887,82 @@ void SatSolver::ProcessNewlyFixedVariablesForDratProof() {
   }
 }
 
+void SatSolver::ProcessNewlyFixedVariablesForLratProof() {
+  if (lrat_proof_handler_ == nullptr) return;
+
+  // Only the literals of level 0 are fixed. Their reasons only contain fixed
+  // literals which appear before them on the trail.
+  const int num_fixed = CurrentDecisionLevel() == 0
+                            ? trail_->Index()
+                            : decisions_[0].trail_index;
+  if (static_cast<int>(lrat_unit_ids_.size()) < num_variables_.value()) {
+    lrat_unit_ids_.resize(num_variables_.value(), kNoClauseId);
+  }
+  for (; lrat_num_processed_fixed_variables_ < num_fixed;
+       ++lrat_num_processed_fixed_variables_) {
+    const Literal literal = (*trail_)[lrat_num_processed_fixed_variables_];
+    const absl::Span<const Literal> reason = trail_->Reason(literal.Variable());
+    ClauseId id;
+    if (reason.empty()) {
+      // The literal was fixed by a unit clause.
+      id = lrat_proof_handler_->GetClauseId({literal});
+    } else {
+      lrat_hints_.clear();
+      for (const Literal l : reason) {
+        lrat_hints_.push_back(lrat_unit_ids_[l.Variable().value()]);
+      }
+      lrat_hints_.push_back(LratReasonId(literal));
+      id = lrat_proof_handler_->AddInferedClause({literal}, lrat_hints_);
+    }
+    lrat_unit_ids_[literal.Variable().value()] = id;
+  }
+}
+
+ClauseId SatSolver::LratReasonId(Literal true_literal) {
+  lrat_clause_.clear();
+  lrat_clause_.push_back(true_literal);
+  for (const Literal l : trail_->Reason(true_literal.Variable())) {
+    lrat_clause_.push_back(l);
+  }
+  return lrat_proof_handler_->GetClauseId(lrat_clause_);
+}
+
+void SatSolver::ComputeLratHints(absl::Span<const Literal> clause,
+                                 std::vector<ClauseId>* hints) {
+  ProcessNewlyFixedVariablesForLratProof();
+  hints->clear();
+  lrat_is_marked_.ClearAndResize(num_variables_);
+  for (const Literal l : clause) lrat_is_marked_.Set(l.Variable());
+
+  // Under the negation of 'clause', the unit clauses of the fixed literals
+  // come first, and then the reasons in trail order propagate all the literals
+  // needed to falsify the failing clause.
+  lrat_trail_indices_.clear();
+  lrat_to_process_.assign(trail_->FailingClause().begin(),
+                          trail_->FailingClause().end());
+  while (!lrat_to_process_.empty()) {
+    const BooleanVariable var = lrat_to_process_.back().Variable();
+    lrat_to_process_.pop_back();
+    if (lrat_is_marked_[var]) continue;
+    lrat_is_marked_.Set(var);
+    const AssignmentInfo& info = trail_->Info(var);
+    if (info.level == 0) {
+      hints->push_back(lrat_unit_ids_[var.value()]);
+      continue;
+    }
+    DCHECK_NE(trail_->AssignmentType(var), AssignmentType::kSearchDecision);
+    lrat_trail_indices_.push_back(info.trail_index);
+    for (const Literal l : trail_->Reason(var)) {
+      lrat_to_process_.push_back(l);
+    }
+  }
+  std::sort(lrat_trail_indices_.begin(), lrat_trail_indices_.end());
+  for (const int trail_index : lrat_trail_indices_) {
+    hints->push_back(LratReasonId((*trail_)[trail_index]));
+  }
+  hints->push_back(lrat_proof_handler_->GetClauseId(trail_->FailingClause()));
+}
+
 void SatSolver::ProcessNewlyFixedVariables() {
   SCOPED_TIME_STAT(&stats_);
   DCHECK_EQ(CurrentDecisionLevel(), 0);
@@ -1846,6 +1970,7 @@ void SatSolver::ProcessNewlyFixedVariables() {
   int num_binary = 0;
 
   ProcessNewlyFixedVariablesForDratProof();
+  ProcessNewlyFixedVariablesForLratProof();
 
   // We remove the clauses that are always true and the fixed literals from the
   // others. Note that none of the clause should be all false because we should
@@ -1855,6 +1980,9 @@ void SatSolver::ProcessNewlyFixedVariables() {
     if (clause->IsRemoved()) continue;
 
     const size_t old_size = clause->size();
+    if (lrat_proof_handler_ != nullptr) {
+      lrat_clause_.assign(clause->begin(), clause->end());
+    }
     if (clause->RemoveFixedLiteralsAndTestIfTrue(trail_->Assignment())) {
       // The clause is always true, detach it.
       clauses_propagator_->LazyDetach(clause);
@@ -1870,6 +1998,17 @@ void SatSolver::ProcessNewlyFixedVariables() {
       drat_proof_handler_->AddClause({clause->begin(), new_size});
       drat_proof_handler_->DeleteClause({clause->begin(), old_size});
     }
+    if (lrat_proof_handler_ != nullptr) {
+      lrat_hints_.clear();
+      for (const Literal l : lrat_clause_) {
+        if (!trail_->Assignment().LiteralIsFalse(l)) continue;
+        lrat_hints_.push_back(lrat_unit_ids_[l.Variable().value()]);
+      }
+      lrat_hints_.push_back(lrat_proof_handler_->GetClauseId(lrat_clause_));
+      lrat_proof_handler_->AddInferedClause({clause->begin(), new_size},
+                                            lrat_hints_);
+      lrat_proof_handler_->DeleteClause(lrat_clause_);
+    }
 
     if (new_size == 2) {
       // This clause is now a binary clause, treat it separately. Note that
@@ -35,6 +35,7 @@
 #include "ortools/base/timer.h"
 #include "ortools/sat/clause.h"
 #include "ortools/sat/drat_proof_handler.h"
+#include "ortools/sat/lrat_proof_handler.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/pb_constraint.h"
 #include "ortools/sat/restart.h"
@@ -449,6 +450,19 @@ class SatSolver {
     binary_implication_graph_->SetDratProofHandler(drat_proof_handler_);
   }
 
+  // Records in the given handler all the problem clauses added after this call,
+  // and all the clauses learned by conflict analysis with their LRAT hints, so
+  // that an UNSAT result can be checked. Only pure clausal problems are
+  // supported, and the conflict minimizations which are not based on the trail
+  // reasons (binary minimization, PB resolution) as well as the clause
+  // minimization by propagation are disabled while a handler is set.
+  //
+  // TODO(user): Produce the hints of the clauses rewritten by inprocessing.
+  void SetLratProofHandler(LratProofHandler* lrat_proof_handler) {
+    lrat_proof_handler_ = lrat_proof_handler;
+    clauses_propagator_->SetLratProofHandler(lrat_proof_handler_);
+  }
+
   // This function is here to deal with the case where a SAT/CP model is found
   // to be trivially UNSAT while the user is constructing the model. Instead of
   // having to test the status of all the lines adding a constraint, one can
@@ -631,6 +645,20 @@ class SatSolver {
   // Output to the DRAT proof handler any newly fixed variables.
   void ProcessNewlyFixedVariablesForDratProof();
 
+  // Adds to the LRAT proof handler a unit clause for each newly fixed variable,
+  // derived from its reason, so that lrat_unit_ids_ is up to date.
+  void ProcessNewlyFixedVariablesForLratProof();
+
+  // Returns the LRAT id of the reason clause of the given assigned literal,
+  // i.e. of the clause made of this literal and of its reason.
+  ClauseId LratReasonId(Literal true_literal);
+
+  // Computes the LRAT hints proving the given clause, whose literals must all
+  // be false, from the current failing clause. This expands the trail reasons
+  // of the literals not in this clause, stopping at the fixed ones.
+  void ComputeLratHints(absl::Span<const Literal> clause,
+                        std::vector<ClauseId>* hints);
+
   // Returns the maximum trail_index of the literals in the given clause.
   // All the literals must be assigned. Returns -1 if the clause is empty.
   int ComputeMaxTrailIndex(absl::Span<const Literal> clause) const;
@@ -798,6 +826,11 @@ class SatSolver {
   // Used in ProcessNewlyFixedVariablesForDratProof().
   int drat_num_processed_fixed_variables_ = 0;
 
+  // Used in ProcessNewlyFixedVariablesForLratProof(). The LRAT id of the unit
+  // clause of each fixed variable, indexed by variable.
+  int lrat_num_processed_fixed_variables_ = 0;
+  std::vector<ClauseId> lrat_unit_ids_;
+
   Counters counters_;
 
   // Solver information.
@@ -862,6 +895,14 @@ class SatSolver {
   double deterministic_time_at_last_advanced_time_limit_ = 0;
 
   DratProofHandler* drat_proof_handler_;
+  LratProofHandler* lrat_proof_handler_ = nullptr;
+
+  // Temporary members used to compute the LRAT hints.
+  SparseBitset<BooleanVariable> lrat_is_marked_;
+  std::vector<Literal> lrat_to_process_;
+  std::vector<int> lrat_trail_indices_;
+  std::vector<Literal> lrat_clause_;
+  std::vector<ClauseId> lrat_hints_;
 
   mutable StatsGroup stats_;
 };
@@ -186,6 +186,8 @@ bool SchedulingConstraintHelper::UpdateCachedValues(int t) {
   if (emin != cached_end_min_[t]) {
     recompute_energy_profile_ = true;
   }
+  if (smin != cached_start_min_[t]) recompute_by_start_min_ = true;
+  if (-emax != cached_negated_end_max_[t]) recompute_by_end_max_ = true;
 
   // We might only want to do that if the value changed, but I am not sure it
   // is worth the test.
@@ -272,6 +274,8 @@ void SchedulingConstraintHelper::InitSortedVectors() {
     task_by_negated_shifted_end_max_[t].presence_lit = reason_for_presence_[t];
   }
 
+  recompute_by_start_min_ = true;
+  recompute_by_end_max_ = true;
   recompute_by_start_max_ = true;
   recompute_by_end_min_ = true;
   recompute_energy_profile_ = true;
@@ -287,6 +291,7 @@ void SchedulingConstraintHelper::SetTimeDirection(bool is_forward) {
     std::swap(ends_, minus_starts_);
 
     std::swap(task_by_increasing_start_min_, task_by_decreasing_end_max_);
+    std::swap(recompute_by_start_min_, recompute_by_end_max_);
     std::swap(task_by_increasing_end_min_,
               task_by_increasing_negated_start_max_);
     std::swap(recompute_by_end_min_, recompute_by_start_max_);
@@ -410,11 +415,13 @@ bool SchedulingConstraintHelper::PropagatePrecedence(int a, int b) {
 
 absl::Span<const TaskTime>
 SchedulingConstraintHelper::TaskByIncreasingStartMin() {
+  if (!recompute_by_start_min_) return task_by_increasing_start_min_;
   for (TaskTime& ref : task_by_increasing_start_min_) {
     ref.time = StartMin(ref.task_index);
   }
   IncrementalSort(task_by_increasing_start_min_.begin(),
                   task_by_increasing_start_min_.end());
+  recompute_by_start_min_ = false;
   return task_by_increasing_start_min_;
 }
 
@@ -444,11 +451,13 @@ SchedulingConstraintHelper::TaskByIncreasingNegatedStartMax() {
 
 absl::Span<const TaskTime>
 SchedulingConstraintHelper::TaskByDecreasingEndMax() {
+  if (!recompute_by_end_max_) return task_by_decreasing_end_max_;
   for (TaskTime& ref : task_by_decreasing_end_max_) {
     ref.time = EndMax(ref.task_index);
   }
   IncrementalSort(task_by_decreasing_end_max_.begin(),
                   task_by_decreasing_end_max_.end(), std::greater<TaskTime>());
+  recompute_by_end_max_ = false;
   return task_by_decreasing_end_max_;
 }
 
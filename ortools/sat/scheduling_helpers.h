@@ -101,6 +101,7 @@ class SchedulingConstraintHelper : public PropagatorInterface {
   // to fetch the maximum possible number of task at construction.
   SchedulingConstraintHelper(int num_tasks, Model* model);
 
+  std::string Name() const final { return "SchedulingConstraintHelper"; }
   // This is a propagator so we can "cache" all the intervals relevant
   // information. This gives good speedup. Note however that the info is stale
   // except if a bound was pushed by this helper or if this was called. We run
@@ -228,6 +229,9 @@ class SchedulingConstraintHelper : public PropagatorInterface {
   // Note that we do not mean strictly-increasing/strictly-decreasing, there
   // will be duplicate time values in these vectors.
   //
+  // The orders are only updated if one of the corresponding bounds changed
+  // since the last call, so all the propagators sharing this helper reuse them.
+  //
   // TODO(user): we could merge the first loop of IncrementalSort() with the
   // loop that fill TaskTime.time at each call.
   absl::Span<const TaskTime> TaskByIncreasingStartMin();
@@ -435,6 +439,8 @@ class SchedulingConstraintHelper : public PropagatorInterface {
   // Sorted vectors returned by the TasksBy*() functions.
   std::vector<TaskTime> task_by_increasing_start_min_;
   std::vector<TaskTime> task_by_decreasing_end_max_;
+  bool recompute_by_start_min_ = true;
+  bool recompute_by_end_max_ = true;
 
   bool recompute_by_start_max_ = true;
   bool recompute_by_end_min_ = true;
@@ -49,6 +49,31 @@ TEST(SchedulingConstraintHelperTest, PushConstantBoundWithOptionalIntervals) {
   EXPECT_FALSE(model.Get(Value(presence2)));
 }
 
+TEST(SchedulingConstraintHelperTest, SortedTasksFollowPushesAndDirection) {
+  Model model;
+  auto* repo = model.GetOrCreate<IntervalsRepository>();
+  const IntervalVariable a = model.Add(NewInterval(0, 100, 10));
+  const IntervalVariable b = model.Add(NewInterval(0, 100, 10));
+  SchedulingConstraintHelper* helper = repo->GetOrCreateHelper({a, b});
+  ASSERT_TRUE(helper->SynchronizeAndSetTimeDirection(true));
+  EXPECT_EQ(helper->TaskByIncreasingStartMin()[0].time, 0);
+  EXPECT_EQ(helper->TaskByDecreasingEndMax()[0].time, 100);
+
+  EXPECT_TRUE(helper->IncreaseStartMin(0, IntegerValue(20)));
+  EXPECT_EQ(helper->TaskByIncreasingStartMin()[0].task_index, 1);
+  EXPECT_EQ(helper->TaskByIncreasingStartMin()[1].time, 20);
+  EXPECT_TRUE(helper->DecreaseEndMax(1, IntegerValue(50)));
+  EXPECT_EQ(helper->TaskByDecreasingEndMax()[0].task_index, 0);
+  EXPECT_EQ(helper->TaskByDecreasingEndMax()[1].time, 50);
+
+  // In the mirrored problem, the start mins are the negated end maxes.
+  ASSERT_TRUE(helper->SynchronizeAndSetTimeDirection(false));
+  EXPECT_EQ(helper->TaskByIncreasingStartMin()[0].task_index, 0);
+  EXPECT_EQ(helper->TaskByIncreasingStartMin()[0].time, -100);
+  EXPECT_EQ(helper->TaskByDecreasingEndMax()[0].task_index, 1);
+  EXPECT_EQ(helper->TaskByDecreasingEndMax()[0].time, 0);
+}
+
 TEST(SchedulingDemandHelperTest, EnergyInWindow) {
   Model model;
 
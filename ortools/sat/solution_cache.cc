@@ -0,0 +1,160 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/solution_cache.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "ortools/base/file.h"
+#include "ortools/base/path.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_checker.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/util/sorted_interval_list.h"
+
+namespace operations_research {
+namespace sat {
+
+std::string SolutionCacheFile(absl::string_view directory,
+                              const CpModelProto& model_proto) {
+  return file::JoinPath(
+      directory, absl::StrFormat("%016x.solution.pb",
+                                 FingerprintModelStructure(model_proto)));
+}
+
+bool LoadCachedSolutionHint(absl::string_view directory,
+                            const CpModelProto& model_proto,
+                            PartialVariableAssignment* hint) {
+  std::string contents;
+  if (!file::GetContents(SolutionCacheFile(directory, model_proto), &contents,
+                         file::Defaults())
+           .ok()) {
+    return false;
+  }
+  PartialVariableAssignment cached;
+  if (!cached.ParseFromString(contents)) return false;
+
+  // Fingerprints can collide, so we validate the cached solution. We always
+  // save the variables in increasing order.
+  const int num_variables = model_proto.variables_size();
+  if (cached.vars_size() != cached.values_size()) return false;
+  int previous_var = -1;
+  for (const int var : cached.vars()) {
+    if (var <= previous_var || var >= num_variables) return false;
+    previous_var = var;
+  }
+
+  // Like for the user hint, we move the values inside the variable domains
+  // which may have changed since the solution was cached.
+  for (int i = 0; i < cached.vars_size(); ++i) {
+    const Domain domain =
+        ReadDomainFromProto(model_proto.variables(cached.vars(i)));
+    if (domain.IsEmpty()) continue;
+    cached.set_values(i, domain.ClosestValue(cached.values(i)));
+  }
+  *hint = std::move(cached);
+  return true;
+}
+
+namespace {
+
+// Returns the unscaled value of the given objective for the given solution.
+double ComputeFloatingPointObjective(const FloatObjectiveProto& objective,
+                                     absl::Span<const int64_t> solution) {
+  double value = objective.offset();
+  for (int i = 0; i < objective.vars_size(); ++i) {
+    value += objective.coeffs(i) *
+             static_cast<double>(solution[objective.vars(i)]);
+  }
+  return value;
+}
+
+// Returns true if the file contains a full solution of the given model which
+// is feasible and at least as good as the given solution.
+bool CachedSolutionIsAsGood(const std::string& file_name,
+                            const CpModelProto& model_proto,
+                            absl::Span<const int64_t> solution) {
+  if (!model_proto.has_objective() &&
+      !model_proto.has_floating_point_objective()) {
+    return false;
+  }
+  std::string contents;
+  if (!file::GetContents(file_name, &contents, file::Defaults()).ok()) {
+    return false;
+  }
+  PartialVariableAssignment cached;
+  if (!cached.ParseFromString(contents)) return false;
+  if (cached.values_size() != model_proto.variables_size()) return false;
+  if (cached.vars_size() != cached.values_size()) return false;
+  for (int i = 0; i < cached.vars_size(); ++i) {
+    if (cached.vars(i) != i) return false;
+  }
+
+  // The model might have been edited since this solution was cached.
+  if (!SolutionIsFeasible(model_proto, cached.values())) return false;
+  if (model_proto.has_objective()) {
+    return ComputeInnerObjective(model_proto.objective(), cached.values()) <=
+           ComputeInnerObjective(model_proto.objective(), solution);
+  }
+  const FloatObjectiveProto& objective = model_proto.floating_point_objective();
+  const double cached_value =
+      ComputeFloatingPointObjective(objective, cached.values());
+  const double value = ComputeFloatingPointObjective(objective, solution);
+  return objective.maximize() ? cached_value >= value : cached_value <= value;
+}
+
+}  // namespace
+
+bool SaveSolutionInCache(absl::string_view directory,
+                         const CpModelProto& model_proto,
+                         const CpSolverResponse& response) {
+  if (response.solution().empty()) return true;
+  const std::string file_name = SolutionCacheFile(directory, model_proto);
+  if (CachedSolutionIsAsGood(file_name, model_proto, response.solution())) {
+    return true;
+  }
+
+  PartialVariableAssignment solution;
+  for (int var = 0; var < response.solution_size(); ++var) {
+    solution.add_vars(var);
+    solution.add_values(response.solution(var));
+  }
+
+  // Several solves might save a solution at the same time, so we write to a
+  // unique temporary file and rename it, which is atomic, so that a reader
+  // never sees a partially written file.
+  absl::BitGen random;
+  const std::string temp_file_name = absl::StrFormat(
+      "%s.%016x.tmp", file_name, absl::Uniform<uint64_t>(random));
+  if (!file::SetContents(temp_file_name, solution.SerializeAsString(),
+                         file::Defaults())
+           .ok()) {
+    return false;
+  }
+  if (std::rename(temp_file_name.c_str(), file_name.c_str()) != 0) {
+    file::Delete(temp_file_name, file::Defaults()).IgnoreError();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace sat
+}  // namespace operations_research
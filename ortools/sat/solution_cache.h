@@ -0,0 +1,54 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A cache of the best solution found for each model structure, stored on disk
+// so that it persists across solves. This is used when the
+// solution_cache_directory parameter is set, to warm-start the solve of a model
+// that is a small edit of an already solved model.
+#ifndef OR_TOOLS_SAT_SOLUTION_CACHE_H_
+#define OR_TOOLS_SAT_SOLUTION_CACHE_H_
+
+#include <string>
+
+#include "absl/strings/string_view.h"
+#include "ortools/sat/cp_model.pb.h"
+
+namespace operations_research {
+namespace sat {
+
+// Returns the file storing the cached solution of the given model. Models with
+// the same FingerprintModelStructure() share the same file.
+std::string SolutionCacheFile(absl::string_view directory,
+                              const CpModelProto& model_proto);
+
+// Fills the given hint with the cached solution of the model, if any. Returns
+// false if there is no cached solution, or if it does not match the model
+// variables. If the model was edited, the values are moved inside the new
+// variable domains. Note that the feasibility of the cached solution is not
+// checked, it is only meant to be used as a hint.
+bool LoadCachedSolutionHint(absl::string_view directory,
+                            const CpModelProto& model_proto,
+                            PartialVariableAssignment* hint);
+
+// Saves the solution of the given response in the cache. Does nothing if the
+// response has no solution, or if the cached solution is feasible for the given
+// model and has an objective at least as good. Returns false if the file could
+// not be written.
+bool SaveSolutionInCache(absl::string_view directory,
+                         const CpModelProto& model_proto,
+                         const CpSolverResponse& response);
+
+}  // namespace sat
+}  // namespace operations_research
+
+#endif  // OR_TOOLS_SAT_SOLUTION_CACHE_H_
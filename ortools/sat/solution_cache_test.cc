@@ -0,0 +1,156 @@
+// Copyright 2010-2025 Google LLC
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ortools/sat/solution_cache.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "ortools/base/file.h"
+#include "ortools/base/filesystem.h"
+#include "ortools/base/gmock.h"
+#include "ortools/base/parse_test_proto.h"
+#include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/cp_model_solver.h"
+#include "ortools/sat/cp_model_utils.h"
+#include "ortools/sat/sat_parameters.pb.h"
+
+namespace operations_research {
+namespace sat {
+namespace {
+
+using ::google::protobuf::contrib::parse_proto::ParseTestProto;
+using ::testing::ElementsAre;
+
+const char kModel[] = R"pb(
+  variables { domain: [ 0, 10 ] }
+  variables { domain: [ 0, 10 ] }
+  constraints {
+    linear {
+      vars: [ 0, 1 ]
+      coeffs: [ 1, 1 ]
+      domain: [ 5, 20 ]
+    }
+  }
+  objective {
+    vars: [ 0, 1 ]
+    coeffs: [ 1, 2 ]
+  }
+)pb";
+
+TEST(FingerprintModelStructureTest, IgnoresDomainsAndCoefficients) {
+  const CpModelProto model = ParseTestProto(kModel);
+  CpModelProto edited = model;
+  edited.mutable_variables(0)->set_domain(1, 20);
+  edited.mutable_constraints(0)->mutable_linear()->set_coeffs(1, 3);
+  edited.mutable_objective()->set_coeffs(0, 5);
+  EXPECT_EQ(FingerprintModelStructure(model),
+            FingerprintModelStructure(edited));
+  EXPECT_NE(FingerprintModel(model), FingerprintModel(edited));
+
+  edited.add_variables()->add_domain(0);
+  edited.mutable_variables(2)->add_domain(1);
+  EXPECT_NE(FingerprintModelStructure(model),
+            FingerprintModelStructure(edited));
+}
+
+TEST(SolutionCacheTest, SaveAndLoad) {
+  const std::string directory = ::testing::TempDir();
+  CpModelProto model = ParseTestProto(kModel);
+  const CpSolverResponse response = ParseTestProto(R"pb(
+    status: OPTIMAL
+    solution: [ 5, 0 ]
+  )pb");
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, response));
+
+  PartialVariableAssignment hint;
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.vars(), ElementsAre(0, 1));
+  EXPECT_THAT(hint.values(), ElementsAre(5, 0));
+
+  // The values are moved inside the domains of the edited model.
+  model.mutable_variables(0)->set_domain(1, 3);
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.values(), ElementsAre(3, 0));
+}
+
+TEST(SolutionCacheTest, WorseSolutionDoesNotOverwriteTheCache) {
+  const std::string directory = ::testing::TempDir() + "/worse_solution";
+  ASSERT_TRUE(file::RecursivelyCreateDir(directory, file::Defaults()).ok());
+  CpModelProto model = ParseTestProto(kModel);
+  const CpSolverResponse best = ParseTestProto(R"pb(solution: [ 5, 0 ])pb");
+  const CpSolverResponse worse = ParseTestProto(R"pb(solution: [ 8, 0 ])pb");
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, best));
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, worse));
+
+  PartialVariableAssignment hint;
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.values(), ElementsAre(5, 0));
+
+  // The cached solution is infeasible for the edited model, so it is replaced
+  // even if the new solution has a worse objective.
+  model.mutable_constraints(0)->mutable_linear()->set_domain(0, 8);
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, worse));
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.values(), ElementsAre(8, 0));
+}
+
+TEST(SolutionCacheTest, WorseSolutionOfFloatingPointObjective) {
+  const std::string directory = ::testing::TempDir() + "/float_objective";
+  ASSERT_TRUE(file::RecursivelyCreateDir(directory, file::Defaults()).ok());
+  CpModelProto model = ParseTestProto(kModel);
+  model.clear_objective();
+  FloatObjectiveProto* objective = model.mutable_floating_point_objective();
+  objective->add_vars(0);
+  objective->add_coeffs(0.5);
+  objective->set_maximize(true);
+  const CpSolverResponse best = ParseTestProto(R"pb(solution: [ 8, 0 ])pb");
+  const CpSolverResponse worse = ParseTestProto(R"pb(solution: [ 5, 0 ])pb");
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, best));
+  ASSERT_TRUE(SaveSolutionInCache(directory, model, worse));
+
+  PartialVariableAssignment hint;
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.values(), ElementsAre(8, 0));
+}
+
+TEST(SolutionCacheTest, NoCachedSolution) {
+  CpModelProto model = ParseTestProto(kModel);
+  model.add_variables()->add_domain(0);
+  model.mutable_variables(2)->add_domain(1);
+  PartialVariableAssignment hint;
+  EXPECT_FALSE(LoadCachedSolutionHint(::testing::TempDir(), model, &hint));
+}
+
+TEST(SolutionCacheTest, SolveFillsTheCache) {
+  const std::string directory = ::testing::TempDir();
+  CpModelProto model = ParseTestProto(kModel);
+  model.mutable_constraints(0)->mutable_linear()->set_domain(0, 7);
+  SatParameters params;
+  params.set_solution_cache_directory(directory);
+  const CpSolverResponse response = SolveWithParameters(model, params);
+  ASSERT_EQ(response.status(), CpSolverStatus::OPTIMAL);
+
+  PartialVariableAssignment hint;
+  ASSERT_TRUE(LoadCachedSolutionHint(directory, model, &hint));
+  EXPECT_THAT(hint.values(), ElementsAre(7, 0));
+
+  // The next solve of an edited model starts from this solution.
+  model.mutable_objective()->set_coeffs(1, 3);
+  EXPECT_EQ(SolveWithParameters(model, params).status(),
+            CpSolverStatus::OPTIMAL);
+}
+
+}  // namespace
+}  // namespace sat
+}  // namespace operations_research
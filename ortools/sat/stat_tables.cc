@@ -26,6 +26,7 @@
 #include "absl/synchronization/mutex.h"
 #include "ortools/lp_data/lp_types.h"
 #include "ortools/sat/cp_model.pb.h"
+#include "ortools/sat/integer.h"
 #include "ortools/sat/linear_programming_constraint.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_solver.h"
@@ -58,14 +59,16 @@ SharedStatTables::SharedStatTables() {
       {"Lp dimension", "Final dimension of first component"});
 
   lp_debug_table_.push_back({"Lp debug", "CutPropag", "CutEqPropag", "Adjust",
-                             "Overflow", "Bad", "BadScaling"});
+                             "Overflow", "Bad", "BadScaling", "SharedBasis",
+                             "SavedIters", "ExportedCuts"});
 
   lp_manager_table_.push_back({"Lp pool", "Constraints", "Updates", "Simplif",
                                "Merged", "Shortened", "Split", "Strenghtened",
                                "Cuts/Call"});
 
   lns_table_.push_back(
-      {"LNS stats", "Improv/Calls", "Closed", "Difficulty", "TimeLimit"});
+      {"LNS stats", "Improv/Calls", "Closed", "Difficulty", "TimeLimit",
+       "Tasks/s"});
 
   ls_table_.push_back({"LS stats", "Batches", "Restarts/Perturbs", "LinMoves",
                        "GenMoves", "CompoundMoves", "Bactracks",
@@ -143,6 +146,9 @@ void SharedStatTables::AddLpStat(absl::string_view name, Model* model) {
   int64_t num_cut_overflows = 0;
   int64_t num_bad_cuts = 0;
   int64_t num_scaling_issues = 0;
+  int64_t num_shared_basis_loads = 0;
+  int64_t num_iterations_saved_by_shared_basis = 0;
+  int64_t num_exported_cuts = 0;
 
   auto* lps = model->GetOrCreate<LinearProgrammingConstraintCollection>();
   for (const auto* lp : *lps) {
@@ -179,6 +185,10 @@ void SharedStatTables::AddLpStat(absl::string_view name, Model* model) {
     num_cut_overflows += lp->num_cut_overflows();
     num_bad_cuts += lp->num_bad_cuts();
     num_scaling_issues += lp->num_scaling_issues();
+    num_shared_basis_loads += lp->num_shared_basis_loads();
+    num_iterations_saved_by_shared_basis +=
+        lp->num_iterations_saved_by_shared_basis();
+    num_exported_cuts += lp->num_exported_cuts();
 
     // Sum for the lp manager table.
     num_constraints += manager.num_constraints();
@@ -214,7 +224,9 @@ void SharedStatTables::AddLpStat(absl::string_view name, Model* model) {
       {FormatName(name), FormatCounter(total_num_cut_propagations),
        FormatCounter(total_num_eq_propagations), FormatCounter(num_adjusts),
        FormatCounter(num_cut_overflows), FormatCounter(num_bad_cuts),
-       FormatCounter(num_scaling_issues)});
+       FormatCounter(num_scaling_issues), FormatCounter(num_shared_basis_loads),
+       FormatCounter(num_iterations_saved_by_shared_basis),
+       FormatCounter(num_exported_cuts)});
 
   lp_manager_table_.push_back({FormatName(name), FormatCounter(num_constraints),
                                FormatCounter(num_constraint_updates),
@@ -227,21 +239,39 @@ void SharedStatTables::AddLpStat(absl::string_view name, Model* model) {
                                             FormatCounter(num_add_cut_calls))});
 }
 
+void SharedStatTables::AddPropagatorStat(Model* model) {
+  const auto* watcher = model->Get<GenericLiteralWatcher>();
+  if (watcher == nullptr) return;
+  const std::vector<PropagatorStats> stats = watcher->GetPropagatorStats();
+  if (stats.empty()) return;
+
+  absl::MutexLock mutex_lock(&mutex_);
+  for (const PropagatorStats& s : stats) {
+    PropagatorStats& total = propagator_stats_[s.name];
+    total.name = s.name;
+    total.MergeFrom(s);
+  }
+}
+
 void SharedStatTables::AddLnsStat(absl::string_view name,
                                   int64_t num_fully_solved_calls,
                                   int64_t num_calls,
                                   int64_t num_improving_calls,
                                   double difficulty,
-                                  double deterministic_limit) {
+                                  double deterministic_limit,
+                                  double wall_time) {
   absl::MutexLock mutex_lock(&mutex_);
   const double fully_solved_proportion =
       static_cast<double>(num_fully_solved_calls) /
       static_cast<double>(std::max(int64_t{1}, num_calls));
+  const double tasks_per_second =
+      wall_time > 0.0 ? static_cast<double>(num_calls) / wall_time : 0.0;
   lns_table_.push_back(
       {FormatName(name), absl::StrCat(num_improving_calls, "/", num_calls),
        absl::StrFormat("%2.0f%%", 100 * fully_solved_proportion),
        absl::StrFormat("%0.2e", difficulty),
-       absl::StrFormat("%0.2f", deterministic_limit)});
+       absl::StrFormat("%0.2f", deterministic_limit),
+       absl::StrFormat("%0.2f", tasks_per_second)});
 }
 
 void SharedStatTables::AddLsStat(absl::string_view name, int64_t num_batches,
@@ -316,6 +346,35 @@ void SharedStatTables::Display(SolverLogger* logger) {
     if (table.size() > 1) SOLVER_LOG(logger, FormatTable(table));
   }
 
+  if (!propagator_stats_.empty()) {
+    std::vector<const PropagatorStats*> sorted;
+    for (const auto& [_, stats] : propagator_stats_) sorted.push_back(&stats);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const PropagatorStats* a, const PropagatorStats* b) {
+                       return a->EstimatedSeconds() > b->EstimatedSeconds();
+                     });
+
+    std::vector<std::vector<std::string>> table;
+    table.push_back({"Propagator stats", "Calls", "NoPush", "IntPushes",
+                     "BoolPushes", "Conflicts", "Reason/Push", "Time(est.)"});
+    for (const PropagatorStats* stats : sorted) {
+      const int64_t num_pushes =
+          stats->num_integer_pushes + stats->num_literal_pushes;
+      const double reason_per_push =
+          static_cast<double>(stats->num_reason_elements) /
+          static_cast<double>(std::max(int64_t{1}, num_pushes));
+      table.push_back(
+          {FormatName(stats->name), FormatCounter(stats->num_calls),
+           FormatCounter(stats->num_calls_without_push),
+           FormatCounter(stats->num_integer_pushes),
+           FormatCounter(stats->num_literal_pushes),
+           FormatCounter(stats->num_conflicts),
+           absl::StrFormat("%.2f", reason_per_push),
+           absl::StrFormat("%.2fs", stats->EstimatedSeconds())});
+    }
+    SOLVER_LOG(logger, FormatTable(table));
+  }
+
   if (lns_table_.size() > 1) SOLVER_LOG(logger, FormatTable(lns_table_));
   if (ls_table_.size() > 1) SOLVER_LOG(logger, FormatTable(ls_table_));
 }
@@ -23,6 +23,7 @@
 #include "absl/container/btree_map.h"
 #include "absl/strings/string_view.h"
 #include "absl/synchronization/mutex.h"
+#include "ortools/sat/integer.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/subsolver.h"
 #include "ortools/util/logging.h"
@@ -43,9 +44,14 @@ class SharedStatTables {
 
   void AddLpStat(absl::string_view name, Model* model);
 
+  // The propagator statistics are summed over all the subsolvers, this does
+  // nothing if they are not collected, see propagator_stats_sampling_period.
+  void AddPropagatorStat(Model* model);
+
   void AddLnsStat(absl::string_view name, int64_t num_fully_solved_calls,
                   int64_t num_calls, int64_t num_improving_calls,
-                  double difficulty, double deterministic_limit);
+                  double difficulty, double deterministic_limit,
+                  double wall_time);
 
   void AddLsStat(absl::string_view name, int64_t num_batches,
                  int64_t num_restarts, int64_t num_linear_moves,
@@ -75,6 +81,10 @@ class SharedStatTables {
   // This one is dynamic, so we generate it in Display().
   std::vector<std::pair<std::string, absl::btree_map<std::string, int>>>
       lp_cut_table_ ABSL_GUARDED_BY(mutex_);
+
+  // Also generated in Display() since it is aggregated by propagator name.
+  absl::btree_map<std::string, PropagatorStats> propagator_stats_
+      ABSL_GUARDED_BY(mutex_);
 };
 
 }  // namespace operations_research::sat
@@ -38,6 +38,10 @@
 #include "ortools/sat/util.h"
 #if !defined(__PORTABLE_PLATFORM__)
 #include "ortools/base/threadpool.h"
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif  // __linux__
 #endif  // __PORTABLE_PLATFORM__
 
 namespace operations_research {
@@ -51,12 +55,17 @@ namespace {
 //
 // For now we use a really basic logic that tries to equilibrate the walltime or
 // deterministic time spent in each subsolver.
+//
+// If is_blocked is not null, the SubSolvers i such that (*is_blocked)[i] is
+// true are not considered either.
 int NextSubsolverToSchedule(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
-                            bool deterministic = true) {
+                            bool deterministic = true,
+                            const std::vector<bool>* is_blocked = nullptr) {
   int best = -1;
   double best_score = std::numeric_limits<double>::infinity();
   for (int i = 0; i < subsolvers.size(); ++i) {
     if (subsolvers[i] == nullptr) continue;
+    if (is_blocked != nullptr && (*is_blocked)[i]) continue;
     if (subsolvers[i]->TaskIsAvailable()) {
       const double score = subsolvers[i]->GetSelectionScore(deterministic);
       if (best == -1 || score < best_score) {
@@ -92,6 +101,36 @@ void SynchronizeAll(absl::Span<const std::unique_ptr<SubSolver>> subsolvers) {
   }
 }
 
+#if !defined(__PORTABLE_PLATFORM__)
+
+// Returns the cpus on which the current thread is allowed to run, or an empty
+// vector if this is unknown.
+std::vector<int> AvailableCpus() {
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0) return cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) cpus.push_back(cpu);
+  }
+#endif  // __linux__
+  return cpus;
+}
+
+void PinCurrentThreadToCpu(int cpu) {
+#if defined(__linux__)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    VLOG(1) << "Couldn't pin thread to cpu " << cpu;
+  }
+#endif  // __linux__
+}
+
+#endif  // __PORTABLE_PLATFORM__
+
 }  // namespace
 
 void SequentialLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers) {
@@ -116,7 +155,8 @@ void SequentialLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers) {
 // On portable platform, we don't support multi-threading for now.
 
 void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
-                          int num_threads, ModelSharedTimeLimit* time_limit) {
+                          int num_threads, ModelSharedTimeLimit* time_limit,
+                          bool pin_threads_to_cpus) {
   SequentialLoop(subsolvers);
 }
 
@@ -195,7 +235,8 @@ void DeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
 
 void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
                           const int num_threads,
-                          ModelSharedTimeLimit* time_limit) {
+                          ModelSharedTimeLimit* time_limit,
+                          bool pin_threads_to_cpus) {
   CHECK_GT(num_threads, 0);
   if (num_threads == 1) {
     return SequentialLoop(subsolvers);
@@ -213,16 +254,93 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
     return num_in_flight < num_threads;
   };
 
-  ThreadPool pool(num_threads);
-  pool.StartWorkers();
+  // When pinning threads, each thread has its own pool so that we can choose
+  // which thread runs a given task. Note that the pools must be destroyed, and
+  // thus all their tasks done, before the variables above.
+  const int num_pools = pin_threads_to_cpus ? num_threads : 1;
+  std::vector<std::unique_ptr<ThreadPool>> pools;
+  for (int i = 0; i < num_pools; ++i) {
+    pools.push_back(std::make_unique<ThreadPool>(num_threads / num_pools));
+    pools.back()->StartWorkers();
+  }
+  if (pin_threads_to_cpus) {
+    const std::vector<int> cpus = AvailableCpus();
+    if (!cpus.empty()) {
+      for (int i = 0; i < num_pools; ++i) {
+        const int cpu = cpus[i % cpus.size()];
+        pools[i]->Schedule([cpu]() { PinCurrentThreadToCpu(cpu); });
+      }
+    }
+  }
+
+  // Only used when num_pools > 1. Guarded by `mutex`.
+  std::vector<bool> pool_is_busy(num_pools, false);
+  std::vector<bool> pool_is_home(num_pools, false);
+  std::vector<int> home_pool(subsolvers.size(), -1);
+
+  // A FULL_PROBLEM subsolver always runs on its home pool once it has one. If
+  // this pool is still busy, which can happen when its last task is done but
+  // the pool was not released yet, the subsolver is skipped. The other tasks
+  // never run on a home pool, so the subsolvers without a home are skipped
+  // while all the free pools are homes. The home of a subsolver which is done
+  // is released.
+  std::vector<bool> is_blocked(subsolvers.size(), false);
+  const auto update_blocked_subsolvers = [&]() {
+    if (num_pools == 1) return;
+    for (int i = 0; i < subsolvers.size(); ++i) {
+      if (subsolvers[i] == nullptr && home_pool[i] != -1) {
+        pool_is_home[home_pool[i]] = false;
+        home_pool[i] = -1;
+      }
+    }
+    bool has_free_pool_without_home = false;
+    for (int i = 0; i < num_pools; ++i) {
+      if (!pool_is_busy[i] && !pool_is_home[i]) {
+        has_free_pool_without_home = true;
+        break;
+      }
+    }
+    for (int i = 0; i < subsolvers.size(); ++i) {
+      is_blocked[i] = home_pool[i] != -1 ? pool_is_busy[home_pool[i]]
+                                         : !has_free_pool_without_home;
+    }
+  };
+
+  // Returns the pool on which to run the next task of the given subsolver.
+  // Must be called while holding `mutex`, for a subsolver that is not blocked.
+  const auto select_pool = [&](int subsolver_index) {
+    if (num_pools == 1) return 0;
+    int& home = home_pool[subsolver_index];
+    if (home != -1) {
+      DCHECK(!pool_is_busy[home]);
+      return home;
+    }
+    int selected = -1;
+    for (int i = 0; i < num_pools; ++i) {
+      if (!pool_is_busy[i] && !pool_is_home[i]) {
+        selected = i;
+        break;
+      }
+    }
+    CHECK_NE(selected, -1);
+    if (subsolvers[subsolver_index]->type() == SubSolver::FULL_PROBLEM) {
+      home = selected;
+      pool_is_home[selected] = true;
+    }
+    return selected;
+  };
 
-  // The lambda below are using little space, but there is no reason
-  // to create millions of them, so we use the blocking nature of
-  // pool.Schedule() when the queue capacity is set.
+  // Each time some workers are free, we synchronize all the subsolvers once and
+  // then fill all these workers before synchronizing again. With many threads,
+  // this avoids calling SynchronizeAll() once per task which was the main
+  // source of contention and idle workers: the synchronization of the shared
+  // classes is amortized over all the tasks of one such "epoch".
   int64_t task_id = 0;
+  int64_t num_epochs = 0;
   while (true) {
     // Set to true if no task is pending right now.
     bool all_done = false;
+    int num_free_workers = 0;
     {
       // Wait if num_in_flight == num_threads.
       const bool condition = mutex.LockWhenWithTimeout(
@@ -243,17 +361,17 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
       // The stopping condition is that we do not have anything else to generate
       // once all the task are done and synchronized.
       if (num_in_flight == 0) all_done = true;
+      num_free_workers = num_threads - num_in_flight;
       mutex.Unlock();
     }
 
     SynchronizeAll(subsolvers);
-    int best = -1;
+    ++num_epochs;
     {
       // We need to do that while holding the lock since substask below might
       // be currently updating the time via AddTaskDuration().
       const absl::MutexLock mutex_lock(&mutex);
       ClearSubsolversThatAreDone(num_in_flight_per_subsolvers, subsolvers);
-      best = NextSubsolverToSchedule(subsolvers, /*deterministic=*/false);
       if (VLOG_IS_ON(1) && time_limit->LimitReached()) {
         std::vector<std::string> debug;
         for (int i = 0; i < subsolvers.size(); ++i) {
@@ -269,7 +387,48 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
         }
       }
     }
-    if (best == -1) {
+
+    // Schedule up to one task per free worker. Note that the selection score
+    // takes into account the tasks scheduled so far, so this still spreads the
+    // tasks between the subsolvers.
+    int num_scheduled = 0;
+    for (; num_scheduled < num_free_workers; ++num_scheduled) {
+      int best = -1;
+      int pool_index = 0;
+      {
+        absl::MutexLock mutex_lock(&mutex);
+        update_blocked_subsolvers();
+        best = NextSubsolverToSchedule(subsolvers, /*deterministic=*/false,
+                                       &is_blocked);
+        if (best == -1) break;
+        subsolvers[best]->NotifySelection();
+        num_in_flight++;
+        num_in_flight_per_subsolvers[best]++;
+        pool_index = select_pool(best);
+        pool_is_busy[pool_index] = true;
+      }
+      std::function<void()> task = subsolvers[best]->GenerateTask(task_id++);
+      const std::string name = subsolvers[best]->name();
+      pools[pool_index]->Schedule([task = std::move(task), name, best,
+                                   pool_index, &subsolvers, &mutex,
+                                   &num_in_flight,
+                                   &num_in_flight_per_subsolvers,
+                                   &pool_is_busy]() {
+        WallTimer timer;
+        timer.Start();
+        task();
+
+        const absl::MutexLock mutex_lock(&mutex);
+        DCHECK(subsolvers[best] != nullptr);
+        DCHECK_GT(num_in_flight_per_subsolvers[best], 0);
+        num_in_flight_per_subsolvers[best]--;
+        pool_is_busy[pool_index] = false;
+        VLOG(1) << name << " done in " << timer.Get() << "s.";
+        subsolvers[best]->AddTaskDuration(timer.Get());
+        num_in_flight--;
+      });
+    }
+    if (num_scheduled == 0) {
       if (all_done) break;
 
       // It is hard to know when new info will allows for more task to be
@@ -279,31 +438,9 @@ void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
       absl::SleepFor(absl::Milliseconds(1));
       continue;
     }
-
-    // Schedule next task.
-    subsolvers[best]->NotifySelection();
-    {
-      absl::MutexLock mutex_lock(&mutex);
-      num_in_flight++;
-      num_in_flight_per_subsolvers[best]++;
-    }
-    std::function<void()> task = subsolvers[best]->GenerateTask(task_id++);
-    const std::string name = subsolvers[best]->name();
-    pool.Schedule([task = std::move(task), name, best, &subsolvers, &mutex,
-                   &num_in_flight, &num_in_flight_per_subsolvers]() {
-      WallTimer timer;
-      timer.Start();
-      task();
-
-      const absl::MutexLock mutex_lock(&mutex);
-      DCHECK(subsolvers[best] != nullptr);
-      DCHECK_GT(num_in_flight_per_subsolvers[best], 0);
-      num_in_flight_per_subsolvers[best]--;
-      VLOG(1) << name << " done in " << timer.Get() << "s.";
-      subsolvers[best]->AddTaskDuration(timer.Get());
-      num_in_flight--;
-    });
   }
+  VLOG(1) << task_id << " tasks scheduled in " << num_epochs
+          << " synchronization epochs.";
 }
 
 #endif  // __PORTABLE_PLATFORM__
@@ -188,9 +188,11 @@ class SynchronizationPoint : public SubSolver {
 };
 
 // Executes the following loop:
-// 1/ Synchronize all in given order.
-// 2/ generate and schedule one task from the current "best" subsolver.
-// 3/ repeat until no extra task can be generated and all tasks are done.
+// 1/ Wait for at least one free thread.
+// 2/ Synchronize all in given order.
+// 3/ generate and schedule one task from the current "best" subsolver for each
+//    thread that was free in 1/.
+// 4/ repeat until no extra task can be generated and all tasks are done.
 //
 // The complexity of each selection is in O(num_subsolvers), but that should
 // be okay given that we don't expect more than 100 such subsolvers.
@@ -198,8 +200,13 @@ class SynchronizationPoint : public SubSolver {
 // Note that it is okay to incorporate "special" subsolver that never produce
 // any tasks. This can be used to synchronize classes used by many subsolvers
 // just once for instance.
+//
+// If pin_threads_to_cpus is true, each thread is pinned to a distinct cpu (this
+// is only supported on Linux and ignored elsewhere), and the tasks of a given
+// FULL_PROBLEM subsolver are always run by the same thread when it is free.
 void NonDeterministicLoop(std::vector<std::unique_ptr<SubSolver>>& subsolvers,
-                          int num_threads, ModelSharedTimeLimit* time_limit);
+                          int num_threads, ModelSharedTimeLimit* time_limit,
+                          bool pin_threads_to_cpus = false);
 
 // Similar to NonDeterministicLoop() except this should result in a
 // deterministic solver provided that all SubSolver respect the Synchronize()
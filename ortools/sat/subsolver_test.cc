@@ -14,12 +14,16 @@
 #include "ortools/sat/subsolver.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <thread>  // NOLINT
 #include <vector>
 
 #include "absl/synchronization/mutex.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
 #include "gtest/gtest.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/util.h"
@@ -31,7 +35,7 @@ namespace {
 // Just a trivial example showing how to use the DeterministicLoop() and
 // NonDeterministicLoop() functions.
 template <bool deterministic>
-void TestLoopFunction() {
+void TestLoopFunction(bool pin_threads_to_cpus = false) {
   struct GlobalState {
     int num_task = 0;
     const int limit = 100;
@@ -95,7 +99,8 @@ void TestLoopFunction() {
   } else {
     Model m;
     ModelSharedTimeLimit shared_limit(&m);
-    NonDeterministicLoop(subsolvers, num_threads, &shared_limit);
+    NonDeterministicLoop(subsolvers, num_threads, &shared_limit,
+                         pin_threads_to_cpus);
   }
   EXPECT_EQ(state.max_update_value, state.limit - 1);
 }
@@ -104,6 +109,189 @@ TEST(DeterministicLoop, BasicTest) { TestLoopFunction<true>(); }
 
 TEST(NonDeterministicLoop, BasicTest) { TestLoopFunction<false>(); }
 
+TEST(NonDeterministicLoop, BasicTestWithPinnedThreads) {
+  TestLoopFunction<false>(/*pin_threads_to_cpus=*/true);
+}
+
+TEST(NonDeterministicLoop, FullProblemTasksStayOnTheSameThread) {
+  // A full problem subsolver with at most one task in flight, which records the
+  // threads running its tasks. Each task makes the subsolver available again a
+  // bit before its thread is released, so that the loop always sees the
+  // subsolver available while its home thread is still busy.
+  class SequentialSubSolver : public SubSolver {
+   public:
+    SequentialSubSolver() : SubSolver("sequential", FULL_PROBLEM) {}
+
+    bool TaskIsAvailable() override {
+      absl::MutexLock mutex_lock(&mutex_);
+      return !task_in_flight_ && thread_ids_.size() < 20;
+    }
+
+    std::function<void()> GenerateTask(int64_t /*id*/) override {
+      {
+        absl::MutexLock mutex_lock(&mutex_);
+        task_in_flight_ = true;
+      }
+      return [this] {
+        {
+          absl::MutexLock mutex_lock(&mutex_);
+          thread_ids_.push_back(std::this_thread::get_id());
+          task_in_flight_ = false;
+        }
+        absl::SleepFor(absl::Milliseconds(1));
+      };
+    }
+
+    void Synchronize() override {}
+
+    std::vector<std::thread::id> thread_ids() {
+      absl::MutexLock mutex_lock(&mutex_);
+      return thread_ids_;
+    }
+
+   private:
+    absl::Mutex mutex_;
+    bool task_in_flight_ = false;
+    std::vector<std::thread::id> thread_ids_;
+  };
+
+  std::vector<std::unique_ptr<SubSolver>> subsolvers;
+  std::vector<SequentialSubSolver*> sequential_subsolvers;
+  for (int i = 0; i < 3; ++i) {
+    subsolvers.push_back(std::make_unique<SequentialSubSolver>());
+    sequential_subsolvers.push_back(
+        static_cast<SequentialSubSolver*>(subsolvers.back().get()));
+  }
+  Model m;
+  ModelSharedTimeLimit shared_limit(&m);
+  NonDeterministicLoop(subsolvers, /*num_threads=*/3, &shared_limit,
+                       /*pin_threads_to_cpus=*/true);
+  for (SequentialSubSolver* subsolver : sequential_subsolvers) {
+    const std::vector<std::thread::id> thread_ids = subsolver->thread_ids();
+    ASSERT_EQ(thread_ids.size(), 20);
+    for (const std::thread::id id : thread_ids) {
+      EXPECT_EQ(id, thread_ids[0]);
+    }
+  }
+}
+
+TEST(NonDeterministicLoop, OtherTasksNeverRunOnAFullProblemThread) {
+  // A subsolver with at most one task in flight, which records the threads
+  // running its tasks. The INCOMPLETE ones only start once the FULL_PROBLEM one
+  // has run a task, and thus has a home thread.
+  class RecordingSubSolver : public SubSolver {
+   public:
+    RecordingSubSolver(SubsolverType type, std::atomic<bool>* started)
+        : SubSolver("recording", type), started_(started) {}
+
+    bool TaskIsAvailable() override {
+      if (type() != FULL_PROBLEM && !started_->load()) return false;
+      absl::MutexLock mutex_lock(&mutex_);
+      return !task_in_flight_ && thread_ids_.size() < 20;
+    }
+
+    std::function<void()> GenerateTask(int64_t /*id*/) override {
+      {
+        absl::MutexLock mutex_lock(&mutex_);
+        task_in_flight_ = true;
+      }
+      return [this] {
+        {
+          absl::MutexLock mutex_lock(&mutex_);
+          thread_ids_.push_back(std::this_thread::get_id());
+          task_in_flight_ = false;
+        }
+        started_->store(true);
+        absl::SleepFor(absl::Milliseconds(1));
+      };
+    }
+
+    void Synchronize() override {}
+
+    std::vector<std::thread::id> thread_ids() {
+      absl::MutexLock mutex_lock(&mutex_);
+      return thread_ids_;
+    }
+
+   private:
+    std::atomic<bool>* started_;
+    absl::Mutex mutex_;
+    bool task_in_flight_ = false;
+    std::vector<std::thread::id> thread_ids_;
+  };
+
+  std::atomic<bool> started = false;
+  std::vector<std::unique_ptr<SubSolver>> subsolvers;
+  subsolvers.push_back(
+      std::make_unique<RecordingSubSolver>(SubSolver::FULL_PROBLEM, &started));
+  for (int i = 0; i < 2; ++i) {
+    subsolvers.push_back(
+        std::make_unique<RecordingSubSolver>(SubSolver::INCOMPLETE, &started));
+  }
+  std::vector<RecordingSubSolver*> recording_subsolvers;
+  for (const auto& subsolver : subsolvers) {
+    recording_subsolvers.push_back(
+        static_cast<RecordingSubSolver*>(subsolver.get()));
+  }
+  Model m;
+  ModelSharedTimeLimit shared_limit(&m);
+  NonDeterministicLoop(subsolvers, /*num_threads=*/2, &shared_limit,
+                       /*pin_threads_to_cpus=*/true);
+
+  const std::vector<std::thread::id> full_problem_thread_ids =
+      recording_subsolvers[0]->thread_ids();
+  ASSERT_EQ(full_problem_thread_ids.size(), 20);
+  for (int i = 1; i < recording_subsolvers.size(); ++i) {
+    const std::vector<std::thread::id> thread_ids =
+        recording_subsolvers[i]->thread_ids();
+    ASSERT_EQ(thread_ids.size(), 20);
+    for (const std::thread::id id : thread_ids) {
+      EXPECT_NE(id, full_problem_thread_ids[0]);
+    }
+  }
+}
+
+TEST(NonDeterministicLoop, FillsAllFreeThreadsAfterOneSynchronization) {
+  class CountingSubSolver : public SubSolver {
+   public:
+    explicit CountingSubSolver(int num_tasks)
+        : SubSolver("counting", FULL_PROBLEM), num_tasks_(num_tasks) {}
+
+    bool TaskIsAvailable() override { return num_generated_ < num_tasks_; }
+
+    std::function<void()> GenerateTask(int64_t /*id*/) override {
+      ++num_generated_;
+      num_synchronizations_at_generation_.push_back(num_synchronizations_);
+      return [] {};
+    }
+
+    void Synchronize() override { ++num_synchronizations_; }
+
+    const std::vector<int>& num_synchronizations_at_generation() const {
+      return num_synchronizations_at_generation_;
+    }
+
+   private:
+    const int num_tasks_;
+    int num_generated_ = 0;
+    int num_synchronizations_ = 0;
+    std::vector<int> num_synchronizations_at_generation_;
+  };
+
+  // All the threads are free at the beginning, so the first tasks must all be
+  // generated after the first synchronization.
+  const int num_threads = 4;
+  std::vector<std::unique_ptr<SubSolver>> subsolvers;
+  subsolvers.push_back(std::make_unique<CountingSubSolver>(num_threads));
+  const CountingSubSolver* subsolver =
+      static_cast<CountingSubSolver*>(subsolvers[0].get());
+  Model m;
+  ModelSharedTimeLimit shared_limit(&m);
+  NonDeterministicLoop(subsolvers, num_threads, &shared_limit);
+  EXPECT_EQ(subsolver->num_synchronizations_at_generation(),
+            std::vector<int>(num_threads, 1));
+}
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
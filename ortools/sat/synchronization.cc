@@ -92,6 +92,60 @@ void SharedLPSolutionRepository::NewLPSolution(
   }
 }
 
+void SharedLPBasisRepository::AddBasis(uint64_t lp_fingerprint,
+                                       const glop::BasisState& basis,
+                                       int64_t num_iterations) {
+  if (basis.IsEmpty()) return;
+  absl::MutexLock mutex_lock(&mutex_);
+  if (bases_.size() >= kMaxNumBases) return;
+  bases_.insert({lp_fingerprint, {basis, num_iterations}});
+}
+
+bool SharedLPBasisRepository::GetBasis(uint64_t lp_fingerprint,
+                                       glop::BasisState* basis,
+                                       int64_t* num_iterations) const {
+  absl::MutexLock mutex_lock(&mutex_);
+  const auto it = bases_.find(lp_fingerprint);
+  if (it == bases_.end()) return false;
+  *basis = it->second.basis;
+  *num_iterations = it->second.num_iterations;
+  return true;
+}
+
+int SharedLPBasisRepository::NumBases() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return bases_.size();
+}
+
+bool SharedCutPool::AddCut(Cut cut) {
+  if (cut.vars.empty()) return false;
+  const size_t hash = absl::HashOf(cut.vars, cut.coeffs);
+  absl::MutexLock mutex_lock(&mutex_);
+  if (cuts_.size() >= kMaxNumCuts) return false;
+  std::vector<int>& indices = cut_indices_by_hash_[hash];
+  for (const int index : indices) {
+    if (cuts_[index].vars == cut.vars && cuts_[index].coeffs == cut.coeffs) {
+      return false;
+    }
+  }
+  indices.push_back(cuts_.size());
+  cuts_.push_back(std::move(cut));
+  return true;
+}
+
+void SharedCutPool::GetNewCuts(int* num_seen, std::vector<Cut>* cuts) const {
+  absl::MutexLock mutex_lock(&mutex_);
+  for (int i = *num_seen; i < cuts_.size(); ++i) {
+    cuts->push_back(cuts_[i]);
+  }
+  *num_seen = cuts_.size();
+}
+
+int SharedCutPool::NumCuts() const {
+  absl::MutexLock mutex_lock(&mutex_);
+  return cuts_.size();
+}
+
 void SharedIncompleteSolutionManager::AddSolution(
     const std::vector<double>& lp_solution) {
   absl::MutexLock mutex_lock(&mutex_);
@@ -1262,23 +1316,42 @@ void SharedClausesManager::SetWorkerNameForId(int id,
 }
 
 void SharedClausesManager::AddBinaryClause(int id, int lit1, int lit2) {
-  if (lit2 < lit1) std::swap(lit1, lit2);
-  const auto p = std::make_pair(lit1, lit2);
+  const std::pair<int, int> clause = {lit1, lit2};
+  AddBinaryClauses(id, absl::MakeConstSpan(&clause, 1));
+}
 
+void SharedClausesManager::AddBinaryClauses(
+    int id, absl::Span<const std::pair<int, int>> clauses) {
   absl::MutexLock mutex_lock(&mutex_);
-  const auto [unused_it, inserted] = added_binary_clauses_set_.insert(p);
-  if (inserted) {
+
+  // Small optim. If the worker is already up to date with clauses to import,
+  // we can mark its new clauses as already seen.
+  const bool is_up_to_date =
+      id_to_last_processed_binary_clause_[id] == added_binary_clauses_.size();
+  for (auto [lit1, lit2] : clauses) {
+    if (lit2 < lit1) std::swap(lit1, lit2);
+    const auto p = std::make_pair(lit1, lit2);
+    const auto [unused_it, inserted] = added_binary_clauses_set_.insert(p);
+    if (!inserted) continue;
     added_binary_clauses_.push_back(p);
     if (always_synchronize_) ++last_visible_binary_clause_;
     id_to_clauses_exported_[id]++;
-
-    // Small optim. If the worker is already up to date with clauses to import,
-    // we can mark this new clause as already seen.
-    if (id_to_last_processed_binary_clause_[id] ==
-        added_binary_clauses_.size() - 1) {
-      id_to_last_processed_binary_clause_[id]++;
-    }
   }
+  if (is_up_to_date) {
+    id_to_last_processed_binary_clause_[id] = added_binary_clauses_.size();
+  }
+}
+
+void BinaryClauseExportBuffer::Add(int lit1, int lit2) {
+  clauses_.push_back({lit1, lit2});
+  if (clauses_.size() >= kMaxBufferedClauses) Flush();
+}
+
+void BinaryClauseExportBuffer::Flush() {
+  if (clauses_.empty()) return;
+  DCHECK(shared_clauses_manager_ != nullptr);
+  shared_clauses_manager_->AddBinaryClauses(id_, clauses_);
+  clauses_.clear();
 }
 
 void SharedClausesManager::AddBatch(int id, CompactVectorVector<int> batch) {
@@ -41,6 +41,7 @@
 #include "ortools/base/logging.h"
 #include "ortools/base/stl_util.h"
 #include "ortools/base/timer.h"
+#include "ortools/glop/variables_info.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/integer_base.h"
 #include "ortools/sat/model.h"
@@ -165,6 +166,72 @@ class SharedLPSolutionRepository : public SharedSolutionRepository<double> {
   void NewLPSolution(std::vector<double> lp_solution);
 };
 
+// Set of optimal bases of the LP relaxations solved at level zero.
+//
+// The bases are keyed by a fingerprint of the LP (its matrix and objective) so
+// that another worker solving the exact same LP can warm-start its dual simplex
+// from it instead of redoing the same pivots. This is thread-safe.
+class SharedLPBasisRepository {
+ public:
+  // Stores the optimal basis of the LP with the given fingerprint that was
+  // found from scratch in num_iterations simplex iterations. We keep the first
+  // basis of each LP, and stop adding new ones once kMaxNumBases is reached.
+  void AddBasis(uint64_t lp_fingerprint, const glop::BasisState& basis,
+                int64_t num_iterations);
+
+  // Returns false if there is no basis for this fingerprint. Otherwise copies
+  // it and the number of iterations it took to find it.
+  bool GetBasis(uint64_t lp_fingerprint, glop::BasisState* basis,
+                int64_t* num_iterations) const;
+
+  int NumBases() const;
+
+ private:
+  static constexpr int kMaxNumBases = 1000;
+
+  struct Entry {
+    glop::BasisState basis;
+    int64_t num_iterations;
+  };
+
+  mutable absl::Mutex mutex_;
+  absl::flat_hash_map<uint64_t, Entry> bases_ ABSL_GUARDED_BY(mutex_);
+};
+
+// A pool of globally valid linear cuts found by the LP relaxations of the
+// workers. The cuts are expressed on the proto variables so that any worker
+// solving the same model can import them in its own LinearConstraintManager.
+// Only one cut is kept for a given set of terms. This is thread-safe.
+class SharedCutPool {
+ public:
+  // lb <= sum coeffs[i] * vars[i] <= ub, with distinct positive vars.
+  struct Cut {
+    std::vector<int> vars;
+    std::vector<int64_t> coeffs;
+    int64_t lb;
+    int64_t ub;
+  };
+
+  // Returns false if the cut was not added because a cut with the same terms is
+  // already in the pool or because the pool already contains kMaxNumCuts cuts.
+  bool AddCut(Cut cut);
+
+  // Appends to cuts all the cuts with an index >= *num_seen in the pool and
+  // updates *num_seen. Each reader should use its own counter, starting at 0.
+  void GetNewCuts(int* num_seen, std::vector<Cut>* cuts) const;
+
+  int NumCuts() const;
+
+ private:
+  static constexpr int kMaxNumCuts = 10000;
+
+  mutable absl::Mutex mutex_;
+  std::vector<Cut> cuts_ ABSL_GUARDED_BY(mutex_);
+  // The indices in cuts_ of the cuts with a given hash of their terms.
+  absl::flat_hash_map<size_t, std::vector<int>> cut_indices_by_hash_
+      ABSL_GUARDED_BY(mutex_);
+};
+
 // Set of best solution from the feasibility jump workers.
 //
 // We store (solution, num_violated_constraints), so we have a list of solutions
@@ -717,6 +784,13 @@ class SharedClausesManager {
   explicit SharedClausesManager(bool always_synchronize);
   void AddBinaryClause(int id, int lit1, int lit2);
 
+  // Same as calling AddBinaryClause() on each clause, but only locks the
+  // manager once. Workers should buffer their new binary clauses and use this
+  // to avoid contention when many workers learn binary clauses at the same
+  // time.
+  void AddBinaryClauses(int id,
+                        absl::Span<const std::pair<int, int>> clauses);
+
   // Returns new glue clauses.
   // The spans are guaranteed to remain valid until the next call to
   // SyncClauses().
@@ -781,6 +855,36 @@ class SharedClausesManager {
   absl::flat_hash_map<int, std::string> id_to_worker_name_;
 };
 
+// Buffers the binary clauses learned by one worker and exports them to a
+// SharedClausesManager in batches, so that the workers do not contend on the
+// manager lock for each learned binary clause. The buffer is exported when it
+// is full or when Flush() is called, which the worker should do periodically
+// and at the end of its search.
+//
+// This class is not thread-safe, each worker has its own instance.
+class BinaryClauseExportBuffer {
+ public:
+  static constexpr int kMaxBufferedClauses = 1024;
+
+  BinaryClauseExportBuffer() = default;
+
+  // Must be called before Add().
+  void Register(int id, SharedClausesManager* shared_clauses_manager) {
+    id_ = id;
+    shared_clauses_manager_ = shared_clauses_manager;
+  }
+
+  void Add(int lit1, int lit2);
+  void Flush();
+
+  int num_buffered_clauses() const { return clauses_.size(); }
+
+ private:
+  int id_ = -1;
+  SharedClausesManager* shared_clauses_manager_ = nullptr;
+  std::vector<std::pair<int, int>> clauses_;
+};
+
 // Simple class to add statistics by name and print them at the end.
 class SharedStatistics {
  public:
@@ -25,6 +25,8 @@
 #include "gtest/gtest.h"
 #include "ortools/base/gmock.h"
 #include "ortools/base/parse_test_proto.h"
+#include "ortools/glop/variables_info.h"
+#include "ortools/lp_data/lp_types.h"
 #include "ortools/sat/cp_model.pb.h"
 #include "ortools/sat/integer_base.h"
 #include "ortools/sat/model.h"
@@ -156,6 +158,58 @@ TEST(SharedLPSolutionRepository, NewLPSolution) {
   EXPECT_EQ(lp_solutions.GetSolution(0)->variable_values[2], 0.0);
 }
 
+TEST(SharedLPBasisRepository, KeepsTheFirstBasisOfEachLp) {
+  SharedLPBasisRepository bases;
+  glop::BasisState basis;
+  int64_t num_iterations;
+  EXPECT_FALSE(bases.GetBasis(123, &basis, &num_iterations));
+
+  // Empty bases are ignored.
+  bases.AddBasis(123, basis, 10);
+  EXPECT_EQ(bases.NumBases(), 0);
+
+  basis.statuses.push_back(glop::VariableStatus::BASIC);
+  basis.statuses.push_back(glop::VariableStatus::AT_LOWER_BOUND);
+  bases.AddBasis(123, basis, 10);
+  basis.statuses[1] = glop::VariableStatus::AT_UPPER_BOUND;
+  bases.AddBasis(123, basis, 5);
+  bases.AddBasis(456, basis, 7);
+  EXPECT_EQ(bases.NumBases(), 2);
+
+  glop::BasisState result;
+  ASSERT_TRUE(bases.GetBasis(123, &result, &num_iterations));
+  EXPECT_EQ(num_iterations, 10);
+  ASSERT_EQ(result.statuses.size(), 2);
+  EXPECT_EQ(result.statuses[glop::ColIndex(1)],
+            glop::VariableStatus::AT_LOWER_BOUND);
+  ASSERT_TRUE(bases.GetBasis(456, &result, &num_iterations));
+  EXPECT_EQ(num_iterations, 7);
+}
+
+TEST(SharedCutPool, DuplicateCutsAreIgnored) {
+  SharedCutPool pool;
+  EXPECT_TRUE(pool.AddCut({{0, 2}, {1, 3}, 0, 4}));
+  EXPECT_FALSE(pool.AddCut({{}, {}, 0, 4}));
+  // Same terms, different bounds.
+  EXPECT_FALSE(pool.AddCut({{0, 2}, {1, 3}, 1, 3}));
+  EXPECT_TRUE(pool.AddCut({{0, 2}, {1, 2}, 0, 4}));
+  EXPECT_EQ(pool.NumCuts(), 2);
+
+  int num_seen = 0;
+  std::vector<SharedCutPool::Cut> cuts;
+  pool.GetNewCuts(&num_seen, &cuts);
+  EXPECT_EQ(num_seen, 2);
+  ASSERT_EQ(cuts.size(), 2);
+  EXPECT_THAT(cuts[1].coeffs, ElementsAre(1, 2));
+
+  EXPECT_TRUE(pool.AddCut({{1}, {1}, 1, 1}));
+  cuts.clear();
+  pool.GetNewCuts(&num_seen, &cuts);
+  EXPECT_EQ(num_seen, 3);
+  ASSERT_EQ(cuts.size(), 1);
+  EXPECT_THAT(cuts[0].vars, ElementsAre(1));
+}
+
 TEST(SharedIncompleteSolutionManager, AddAndRemoveSolutions) {
   SharedIncompleteSolutionManager incomplete_solutions;
 
@@ -859,6 +913,57 @@ TEST(SharedClausesManagerTest, SyncApi) {
   EXPECT_TRUE(new_clauses.empty());
 }
 
+TEST(SharedClausesManagerTest, AddBinaryClausesInBatch) {
+  SharedClausesManager manager(/*always_synchronize=*/true);
+  EXPECT_EQ(0, manager.RegisterNewId(/*may_terminate_early=*/false));
+  EXPECT_EQ(1, manager.RegisterNewId(/*may_terminate_early=*/false));
+
+  const std::vector<std::pair<int, int>> batch = {{1, 2}, {3, 2}, {2, 1}};
+  manager.AddBinaryClauses(/*id=*/0, batch);
+  std::vector<std::pair<int, int>> new_clauses;
+  manager.GetUnseenBinaryClauses(/*id=*/0, &new_clauses);
+  EXPECT_TRUE(new_clauses.empty());
+  manager.GetUnseenBinaryClauses(/*id=*/1, &new_clauses);
+  EXPECT_THAT(new_clauses, ::testing::ElementsAre(std::make_pair(1, 2),
+                                                  std::make_pair(2, 3)));
+
+  // Worker 0 is not up to date anymore, so it will see its own clauses.
+  manager.AddBinaryClauses(/*id=*/1, {{4, 5}});
+  manager.AddBinaryClauses(/*id=*/0, {{5, 6}, {4, 5}});
+  manager.GetUnseenBinaryClauses(/*id=*/0, &new_clauses);
+  EXPECT_THAT(new_clauses, ::testing::ElementsAre(std::make_pair(4, 5),
+                                                  std::make_pair(5, 6)));
+}
+
+TEST(BinaryClauseExportBufferTest, ExportsWhenFullOrFlushed) {
+  SharedClausesManager manager(/*always_synchronize=*/true);
+  EXPECT_EQ(0, manager.RegisterNewId(/*may_terminate_early=*/false));
+  EXPECT_EQ(1, manager.RegisterNewId(/*may_terminate_early=*/false));
+  BinaryClauseExportBuffer buffer;
+  buffer.Register(/*id=*/0, &manager);
+
+  // The clauses are only visible to the other worker once flushed.
+  buffer.Add(1, 2);
+  buffer.Add(3, 2);
+  std::vector<std::pair<int, int>> new_clauses;
+  manager.GetUnseenBinaryClauses(/*id=*/1, &new_clauses);
+  EXPECT_TRUE(new_clauses.empty());
+  buffer.Flush();
+  EXPECT_EQ(buffer.num_buffered_clauses(), 0);
+  manager.GetUnseenBinaryClauses(/*id=*/1, &new_clauses);
+  EXPECT_THAT(new_clauses, ::testing::ElementsAre(std::make_pair(1, 2),
+                                                  std::make_pair(2, 3)));
+
+  // A full buffer is exported right away.
+  for (int i = 0; i < BinaryClauseExportBuffer::kMaxBufferedClauses; ++i) {
+    buffer.Add(10 + 2 * i, 11 + 2 * i);
+  }
+  EXPECT_EQ(buffer.num_buffered_clauses(), 0);
+  manager.GetUnseenBinaryClauses(/*id=*/1, &new_clauses);
+  EXPECT_EQ(static_cast<int>(new_clauses.size()),
+            BinaryClauseExportBuffer::kMaxBufferedClauses);
+}
+
 TEST(UniqueClauseStreamTest, AddIgnoresDuplicates) {
   UniqueClauseStream stream;
 
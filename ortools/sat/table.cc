@@ -13,6 +13,8 @@
 
 #include "ortools/sat/table.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <utility>
 #include <vector>
@@ -20,6 +22,7 @@
 #include "absl/container/flat_hash_map.h"
 #include "absl/log/check.h"
 #include "absl/types/span.h"
+#include "ortools/sat/integer.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
 #include "ortools/sat/sat_solver.h"
@@ -78,5 +81,197 @@ std::function<void(Model*)> LiteralTableConstraint(
   };
 }
 
+CompactTablePropagator::CompactTablePropagator(
+    absl::Span<const std::vector<Literal>> literal_tuples, Model* model)
+    : num_columns_(literal_tuples.empty() ? 0 : literal_tuples[0].size()),
+      num_words_((literal_tuples.size() + 63) / 64),
+      trail_(model->GetOrCreate<Trail>()),
+      assignment_(trail_->Assignment()) {
+  const int num_tuples = literal_tuples.size();
+  CHECK_GT(num_tuples, 0);
+  absl::flat_hash_map<LiteralIndex, int> literal_to_watch_index;
+  for (int c = 0; c < num_columns_; ++c) {
+    column_starts_.push_back(support_literals_.size());
+    absl::flat_hash_map<LiteralIndex, int> literal_to_support;
+    for (int t = 0; t < num_tuples; ++t) {
+      DCHECK_EQ(literal_tuples[t].size(), num_columns_);
+      const Literal literal = literal_tuples[t][c];
+      auto [it, inserted] = literal_to_support.insert(
+          {literal.Index(), support_literals_.size()});
+      if (inserted) {
+        support_literals_.push_back(literal);
+        support_masks_.resize(support_masks_.size() + num_words_, 0);
+        residues_.push_back(t / 64);
+
+        auto [watch_it, new_watch] = literal_to_watch_index.insert(
+            {literal.Index(), watch_index_to_literal_.size()});
+        if (new_watch) {
+          watch_index_to_literal_.push_back(literal);
+          watch_index_to_supports_.push_back({});
+        }
+        watch_index_to_supports_[watch_it->second].push_back(it->second);
+      }
+      support_masks_[static_cast<size_t>(it->second) * num_words_ + t / 64] |=
+          uint64_t{1} << (t % 64);
+    }
+  }
+  column_starts_.push_back(support_literals_.size());
+
+  // All tuples are valid initially, the first call to Propagate() removes the
+  // ones with a literal already at false.
+  words_.assign(num_words_, ~uint64_t{0});
+  if (num_tuples % 64 != 0) {
+    words_.back() = (uint64_t{1} << (num_tuples % 64)) - 1;
+  }
+  for (int w = 0; w < num_words_; ++w) non_zero_words_.push_back(w);
+  num_non_zero_words_ = num_words_;
+}
+
+void CompactTablePropagator::RegisterWith(GenericLiteralWatcher* watcher) {
+  const int id = watcher->Register(this);
+  bool literal_is_in_several_columns = false;
+  for (int w = 0; w < watch_index_to_literal_.size(); ++w) {
+    watcher->WatchLiteral(watch_index_to_literal_[w].Negated(), id, w);
+
+    // A literal has only one support per column.
+    if (watch_index_to_supports_[w].size() > 1) {
+      literal_is_in_several_columns = true;
+    }
+  }
+  watcher->RegisterReversibleClass(id, this);
+
+  // Fixing to false a literal without support in one column removes the tuples
+  // containing it in the other columns, which is only seen by the next call.
+  if (literal_is_in_several_columns) {
+    watcher->NotifyThatPropagatorMayNotReachFixedPointInOnePass(id);
+  }
+}
+
+void CompactTablePropagator::SetLevel(int level) {
+  if (level == level_starts_.size()) return;
+  if (level > level_starts_.size()) {
+    while (level > level_starts_.size()) {
+      level_starts_.push_back({saved_words_.size(), num_non_zero_words_});
+    }
+    return;
+  }
+
+  // Backtrack. Note that a word might have been saved many times, so we need
+  // to restore them in reverse order.
+  const auto [num_saved_words, num_non_zero_words] = level_starts_[level];
+  for (int i = saved_words_.size() - 1; i >= num_saved_words; --i) {
+    words_[saved_words_[i].first] = saved_words_[i].second;
+  }
+  saved_words_.resize(num_saved_words);
+  num_non_zero_words_ = num_non_zero_words;
+  level_starts_.resize(level);
+}
+
+void CompactTablePropagator::RemoveTuples(int support) {
+  const absl::Span<const uint64_t> mask = SupportMask(support);
+  for (int i = 0; i < num_non_zero_words_; ++i) {
+    const int w = non_zero_words_[i];
+    const uint64_t new_word = words_[w] & ~mask[w];
+    if (new_word == words_[w]) continue;
+
+    // Nothing to save at level zero, we never backtrack over it.
+    if (!level_starts_.empty()) saved_words_.push_back({w, words_[w]});
+    words_[w] = new_word;
+    if (new_word == 0) {
+      std::swap(non_zero_words_[i], non_zero_words_[num_non_zero_words_ - 1]);
+      --num_non_zero_words_;
+      --i;
+    }
+  }
+}
+
+bool CompactTablePropagator::HasValidTuple(int support) {
+  const absl::Span<const uint64_t> mask = SupportMask(support);
+  const int residue = residues_[support];
+  if ((words_[residue] & mask[residue]) != 0) return true;
+  for (int i = 0; i < num_non_zero_words_; ++i) {
+    const int w = non_zero_words_[i];
+    if ((words_[w] & mask[w]) != 0) {
+      residues_[support] = w;
+      return true;
+    }
+  }
+  return false;
+}
+
+void CompactTablePropagator::FillReason(int column,
+                                        std::vector<Literal>* reason) const {
+  reason->clear();
+  for (int c = 0; c < num_columns_; ++c) {
+    if (c == column) continue;
+    for (int s = column_starts_[c]; s < column_starts_[c + 1]; ++s) {
+      const Literal literal = support_literals_[s];
+      if (!assignment_.LiteralIsFalse(literal)) continue;
+      if (trail_->Info(literal.Variable()).level == 0) continue;
+      reason->push_back(literal);
+    }
+  }
+}
+
+bool CompactTablePropagator::FilterSupports() {
+  if (num_non_zero_words_ == 0) {
+    FillReason(/*column=*/-1, trail_->MutableConflict());
+    return false;
+  }
+  for (int c = 0; c < num_columns_; ++c) {
+    // All the literals of a column have the same reason, so we only compute it
+    // for the first one.
+    BooleanVariable variable_with_same_reason = kNoBooleanVariable;
+    for (int s = column_starts_[c]; s < column_starts_[c + 1]; ++s) {
+      const Literal literal = support_literals_[s];
+      if (assignment_.LiteralIsFalse(literal)) continue;
+      if (HasValidTuple(s)) continue;
+      if (variable_with_same_reason == kNoBooleanVariable ||
+          assignment_.LiteralIsTrue(literal)) {
+        variable_with_same_reason = literal.Variable();
+        FillReason(c, trail_->GetEmptyVectorToStoreReason());
+        if (!trail_->EnqueueWithStoredReason(literal.Negated())) return false;
+      } else {
+        trail_->EnqueueWithSameReasonAs(literal.Negated(),
+                                        variable_with_same_reason);
+      }
+    }
+  }
+  return true;
+}
+
+bool CompactTablePropagator::Propagate() {
+  for (int s = 0; s < support_literals_.size(); ++s) {
+    if (assignment_.LiteralIsFalse(support_literals_[s])) RemoveTuples(s);
+  }
+  return FilterSupports();
+}
+
+bool CompactTablePropagator::IncrementalPropagate(
+    const std::vector<int>& watch_indices) {
+  for (const int w : watch_indices) {
+    for (const int s : watch_index_to_supports_[w]) {
+      RemoveTuples(s);
+    }
+  }
+  return FilterSupports();
+}
+
+std::function<void(Model*)> CompactTableConstraint(
+    absl::Span<const std::vector<Literal>> literal_tuples) {
+  return [literal_tuples = std::vector<std::vector<Literal>>(
+              literal_tuples.begin(), literal_tuples.end())](Model* model) {
+    if (literal_tuples.empty()) {
+      model->GetOrCreate<SatSolver>()->NotifyThatModelIsUnsat();
+      return;
+    }
+    if (literal_tuples[0].empty()) return;
+    CompactTablePropagator* constraint =
+        new CompactTablePropagator(literal_tuples, model);
+    constraint->RegisterWith(model->GetOrCreate<GenericLiteralWatcher>());
+    model->TakeOwnership(constraint);
+  };
+}
+
 }  // namespace sat
 }  // namespace operations_research
@@ -14,12 +14,18 @@
 #ifndef OR_TOOLS_SAT_TABLE_H_
 #define OR_TOOLS_SAT_TABLE_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "absl/types/span.h"
+#include "ortools/sat/integer.h"
 #include "ortools/sat/model.h"
 #include "ortools/sat/sat_base.h"
+#include "ortools/util/rev.h"
 
 namespace operations_research {
 namespace sat {
@@ -32,6 +38,89 @@ std::function<void(Model*)> LiteralTableConstraint(
     absl::Span<const std::vector<Literal>> literal_tuples,
     absl::Span<const Literal> line_literals);
 
+// Propagates a positive table constraint with the Compact-Table algorithm of
+// J. Demeulenaere, R. Hartert, C. Lecoutre, G. Perez, L. Perron, J-C. Regin,
+// P. Schaus, "Compact-Table: Efficiently Filtering Table Constraints with
+// Reversible Sparse Bit-Sets", CP 2016.
+//
+// literal_tuples[t][c] is the literal that is true iff the column c takes the
+// value it has in the tuple t. The literals of a column must be the full
+// encoding of a variable restricted to the values that appear in the table,
+// that is exactly one of them must be true.
+//
+// Unlike LiteralTableConstraint(), this does not create one literal per tuple.
+// The set of valid tuples is a bitset that is only updated word by word, and
+// for each literal we keep a word where it was last found supported.
+class CompactTablePropagator : public PropagatorInterface,
+                               ReversibleInterface {
+ public:
+  CompactTablePropagator(absl::Span<const std::vector<Literal>> literal_tuples,
+                         Model* model);
+
+  // This type is neither copyable nor movable.
+  CompactTablePropagator(const CompactTablePropagator&) = delete;
+  CompactTablePropagator& operator=(const CompactTablePropagator&) = delete;
+
+  void SetLevel(int level) final;
+  std::string Name() const final { return "CompactTablePropagator"; }
+  bool Propagate() final;
+  bool IncrementalPropagate(const std::vector<int>& watch_indices) final;
+  void RegisterWith(GenericLiteralWatcher* watcher);
+
+ private:
+  // A "support" is a distinct (column, literal) pair of the table. Its mask is
+  // the set of tuples that contain this literal in this column.
+  absl::Span<const uint64_t> SupportMask(int support) const {
+    return absl::MakeConstSpan(
+        &support_masks_[static_cast<size_t>(support) * num_words_], num_words_);
+  }
+
+  // Removes the tuples of the given support from the valid tuples.
+  void RemoveTuples(int support);
+
+  // Returns true if at least one valid tuple contains the given support.
+  bool HasValidTuple(int support);
+
+  // Sets the literals of the supports with no valid tuples to false.
+  bool FilterSupports();
+
+  // Fills the reason with all the literals of the table that are false and not
+  // in the given column, or in any column if column is -1. The tuples of a
+  // support of this column can only have been removed because of them.
+  void FillReason(int column, std::vector<Literal>* reason) const;
+
+  const int num_columns_;
+  const int num_words_;
+  Trail* trail_;
+  const VariablesAssignment& assignment_;
+
+  // Support data. The supports of the column c are in
+  // [column_starts_[c], column_starts_[c + 1]).
+  std::vector<int> column_starts_;
+  std::vector<Literal> support_literals_;
+  std::vector<uint64_t> support_masks_;
+  std::vector<int> residues_;
+
+  // The same literal can appear in more than one column.
+  std::vector<Literal> watch_index_to_literal_;
+  std::vector<std::vector<int>> watch_index_to_supports_;
+
+  // The valid tuples, as a reversible sparse bitset: the non-zero words are
+  // exactly the words_[non_zero_words_[i]] for i < num_non_zero_words_. The
+  // words changed at a positive level are saved in saved_words_ and restored
+  // on backtrack, the order of non_zero_words_ does not need to be.
+  std::vector<uint64_t> words_;
+  std::vector<int> non_zero_words_;
+  int num_non_zero_words_;
+  std::vector<std::pair<int, uint64_t>> saved_words_;
+  std::vector<std::pair<int, int>> level_starts_;
+};
+
+// Adds a CompactTablePropagator for the given table. See the class comment for
+// the requirements on literal_tuples.
+std::function<void(Model*)> CompactTableConstraint(
+    absl::Span<const std::vector<Literal>> literal_tuples);
+
 }  // namespace sat
 }  // namespace operations_research
 
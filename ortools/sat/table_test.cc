@@ -19,7 +19,11 @@
 #include <vector>
 
 #include "absl/container/btree_set.h"
+#include "absl/random/bit_gen_ref.h"
+#include "absl/random/distributions.h"
+#include "absl/random/random.h"
 #include "absl/types/span.h"
+#include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
 #include "ortools/base/container_logging.h"
 #include "ortools/base/gmock.h"
@@ -682,6 +686,127 @@ TEST(LiteralTableConstraint, PropagationFromSelected) {
   EXPECT_TRUE(sat_solver->Assignment().LiteralIsFalse(literals[1][1]));
 }
 
+TEST(CompactTablePropagatorTest, PropagationAndBacktrack) {
+  Model model;
+  std::vector<std::vector<Literal>> literals(3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      literals[i].push_back(Literal(model.Add(NewBooleanVariable()), true));
+    }
+    model.Add(ExactlyOneConstraint(literals[i]));
+  }
+
+  // Tuples (0, 0, 0), (1, 1, 1), (2, 2, 2), (0, 1, 2).
+  std::vector<std::vector<Literal>> tuples = {
+      {literals[0][0], literals[1][0], literals[2][0]},
+      {literals[0][1], literals[1][1], literals[2][1]},
+      {literals[0][2], literals[1][2], literals[2][2]},
+      {literals[0][0], literals[1][1], literals[2][2]}};
+
+  model.Add(CompactTableConstraint(tuples));
+  SatSolver* sat_solver = model.GetOrCreate<SatSolver>();
+
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(literals[0][0]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsFalse(literals[1][2]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsFalse(literals[2][1]));
+  EXPECT_FALSE(sat_solver->Assignment().VariableIsAssigned(
+      literals[1][1].Variable()));
+
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(literals[1][1]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsTrue(literals[2][2]));
+
+  // After a backtrack, the removed tuples are valid again.
+  sat_solver->Backtrack(0);
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(literals[2][1]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsTrue(literals[0][1]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsTrue(literals[1][1]));
+
+  sat_solver->Backtrack(0);
+  EXPECT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(literals[1][0]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsTrue(literals[0][0]));
+  EXPECT_TRUE(sat_solver->Assignment().LiteralIsTrue(literals[2][0]));
+}
+
+// Returns a model with two random tables on the variables (0, 1, 2, 3) and
+// (2, 3, 4) whose domains are [0, num_values).
+CpModelProto RandomTablesModel(int num_tuples, int num_values,
+                               absl::BitGenRef random) {
+  CpModelProto model_proto;
+  for (int v = 0; v < 5; ++v) {
+    model_proto.add_variables()->add_domain(0);
+    model_proto.mutable_variables(v)->add_domain(num_values - 1);
+  }
+  for (const std::vector<int>& vars :
+       std::vector<std::vector<int>>{{0, 1, 2, 3}, {2, 3, 4}}) {
+    TableConstraintProto* table =
+        model_proto.add_constraints()->mutable_table();
+    for (const int var : vars) {
+      table->add_exprs()->add_vars(var);
+      table->mutable_exprs()->rbegin()->add_coeffs(1);
+    }
+    for (int t = 0; t < num_tuples; ++t) {
+      for (int i = 0; i < vars.size(); ++i) {
+        table->add_values(absl::Uniform<int64_t>(random, 0, num_values));
+      }
+    }
+  }
+  return model_proto;
+}
+
+int CountSolutions(const CpModelProto& model_proto, SatParameters params) {
+  params.set_enumerate_all_solutions(true);
+  params.set_keep_all_feasible_solutions_in_presolve(true);
+  Model model;
+  model.Add(NewSatParameters(params));
+  int count = 0;
+  model.Add(NewFeasibleSolutionObserver(
+      [&count](const CpSolverResponse& /*response*/) { ++count; }));
+  SolveCpModel(model_proto, &model);
+  return count;
+}
+
+TEST(CompactTablePropagatorTest, SameSolutionsAsExpansion) {
+  absl::BitGen random;
+  for (int i = 0; i < 20; ++i) {
+    const CpModelProto model_proto =
+        RandomTablesModel(/*num_tuples=*/100, /*num_values=*/5, random);
+    SatParameters params;
+    const int num_solutions = CountSolutions(model_proto, params);
+    params.set_compact_table_min_num_tuples(1);
+    EXPECT_EQ(CountSolutions(model_proto, params), num_solutions);
+  }
+}
+
+// Minimizes the sum of the variables of a model with two large tables, with
+// the compact table propagator if state.range(1) is true or with the default
+// expansion otherwise. Reports the number of Booleans, which is the main memory
+// cost of the expansion.
+static void BM_SolveLargeTables(benchmark::State& state) {
+  absl::BitGen random;
+  CpModelProto model_proto =
+      RandomTablesModel(/*num_tuples=*/state.range(0), /*num_values=*/40,
+                        random);
+  for (int v = 0; v < model_proto.variables_size(); ++v) {
+    model_proto.mutable_objective()->add_vars(v);
+    model_proto.mutable_objective()->add_coeffs(1);
+  }
+  SatParameters params;
+  params.set_num_workers(1);
+  if (state.range(1)) params.set_compact_table_min_num_tuples(1000);
+  int64_t num_booleans = 0;
+  for (auto _ : state) {
+    const CpSolverResponse response = SolveWithParameters(model_proto, params);
+    num_booleans = response.num_booleans();
+  }
+  state.counters["num_booleans"] = num_booleans;
+}
+
+BENCHMARK(BM_SolveLargeTables)
+    ->Args({10000, 0})
+    ->Args({10000, 1})
+    ->Args({100000, 0})
+    ->Args({100000, 1});
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
@@ -15,6 +15,7 @@
 #define OR_TOOLS_SAT_TIMETABLE_H_
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "ortools/sat/integer.h"
@@ -52,6 +53,7 @@ class ReservoirTimeTabling : public PropagatorInterface {
                        const std::vector<Literal>& presences,
                        IntegerValue capacity, Model* model);
 
+  std::string Name() const final { return "ReservoirTimeTabling"; }
   bool Propagate() final;
 
  private:
@@ -116,6 +118,7 @@ class TimeTablingPerTask : public PropagatorInterface {
   TimeTablingPerTask(const TimeTablingPerTask&) = delete;
   TimeTablingPerTask& operator=(const TimeTablingPerTask&) = delete;
 
+  std::string Name() const final { return "TimeTablingPerTask"; }
   bool Propagate() final;
 
   void RegisterWith(GenericLiteralWatcher* watcher);
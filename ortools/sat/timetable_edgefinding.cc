@@ -150,6 +150,29 @@ void TimeTableEdgeFinding::BuildTimeTable() {
   }
 }
 
+void TimeTableEdgeFinding::FillWindowTasks() {
+  window_tasks_.clear();
+  window_start_mins_.clear();
+  window_end_maxs_.clear();
+  window_size_frees_.clear();
+  window_energy_frees_.clear();
+  window_demand_mins_.clear();
+  window_mandatory_energies_.clear();
+  const auto by_start_min = helper_->TaskByIncreasingStartMin();
+  for (const auto [t, start_min] : ::gtl::reversed_view(by_start_min)) {
+    // TODO(user): consider optional tasks for additional propagation.
+    if (!helper_->IsPresent(t)) continue;
+    if (energy_free_[t] == 0) continue;
+    window_tasks_.push_back(t);
+    window_start_mins_.push_back(start_min);
+    window_end_maxs_.push_back(helper_->EndMax(t));
+    window_size_frees_.push_back(size_free_[t]);
+    window_energy_frees_.push_back(energy_free_[t]);
+    window_demand_mins_.push_back(demands_->DemandMin(t));
+    window_mandatory_energies_.push_back(mandatory_energy_before_start_min_[t]);
+  }
+}
+
 bool TimeTableEdgeFinding::TimeTableEdgeFindingPass() {
   if (!demands_->CacheAllEnergyValues()) return true;
 
@@ -192,7 +215,8 @@ bool TimeTableEdgeFinding::TimeTableEdgeFindingPass() {
   // the min energy instead of the demand_min * size_min? How can we incorporate
   // this extra energy in the mandatory profile ?
   BuildTimeTable();
-  const auto& by_start_min = helper_->TaskByIncreasingStartMin();
+  FillWindowTasks();
+  const int num_window_tasks = window_tasks_.size();
 
   IntegerValue previous_end = kMaxIntegerValue;
 
@@ -225,20 +249,16 @@ bool TimeTableEdgeFinding::TimeTableEdgeFindingPass() {
 
     // Process task by decreasing start min.
     const IntegerValue window_max = end_task_time.time;
-    for (const TaskTime begin_task_time : gtl::reversed_view(by_start_min)) {
-      const int begin_task = begin_task_time.task_index;
+    for (int i = 0; i < num_window_tasks; ++i) {
+      const int begin_task = window_tasks_[i];
 
       // The considered time window. Note that we use the "cached" values so
       // that our mandatory energy before computation is correct.
-      const IntegerValue window_min = begin_task_time.time;
+      const IntegerValue window_min = window_start_mins_[i];
 
       // Not a valid time window.
       if (window_max <= window_min) continue;
 
-      // TODO(user): consider optional tasks for additional propagation.
-      if (!helper_->IsPresent(begin_task)) continue;
-      if (energy_free_[begin_task] == 0) continue;
-
       // We consider two different cases: either the free part overlaps the
       // window_max of the interval (right) or it does not (inside).
       //
@@ -255,22 +275,21 @@ bool TimeTableEdgeFinding::TimeTableEdgeFindingPass() {
       // energy of the free part. In the right case, the additional energy is
       // equal to the largest part of the free part that can fit in the task
       // interval.
-      const IntegerValue end_max = helper_->EndMax(begin_task);
+      const IntegerValue end_max = window_end_maxs_[i];
       if (end_max <= window_max) {
         // The whole task energy is contained in the window.
         reason_tasks_fully_included_in_window_.push_back(begin_task);
-        energy_free_parts += energy_free_[begin_task];
+        energy_free_parts += window_energy_frees_[i];
       } else {
-        const IntegerValue demand_min = demands_->DemandMin(begin_task);
+        const IntegerValue demand_min = window_demand_mins_[i];
+        const IntegerValue size_free = window_size_frees_[i];
         const IntegerValue extra_energy =
-            std::min(size_free_[begin_task], (window_max - window_min)) *
-            demand_min;
+            std::min(size_free, (window_max - window_min)) * demand_min;
 
         // This is not in the paper, but it is almost free for us to account for
         // the free energy of this task that must be present in the window.
         const IntegerValue free_energy_in_window =
-            std::max(IntegerValue(0),
-                     size_free_[begin_task] - (end_max - window_max)) *
+            std::max(IntegerValue(0), size_free - (end_max - window_max)) *
             demand_min;
 
         // TODO(user): There is no point setting max_task if its start min
@@ -309,7 +328,7 @@ bool TimeTableEdgeFinding::TimeTableEdgeFindingPass() {
           CapacityMax() * (window_max - window_min);
       const IntegerValue energy_mandatory =
           mandatory_energy_before_end_max_[end_task] -
-          mandatory_energy_before_start_min_[begin_task];
+          window_mandatory_energies_[i];
       const IntegerValue available_energy =
           window_energy - energy_free_parts - energy_mandatory;
 
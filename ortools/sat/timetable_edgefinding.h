@@ -14,6 +14,7 @@
 #ifndef OR_TOOLS_SAT_TIMETABLE_EDGEFINDING_H_
 #define OR_TOOLS_SAT_TIMETABLE_EDGEFINDING_H_
 
+#include <string>
 #include <vector>
 
 #include "ortools/sat/integer.h"
@@ -68,6 +69,7 @@ class TimeTableEdgeFinding : public PropagatorInterface {
   TimeTableEdgeFinding(const TimeTableEdgeFinding&) = delete;
   TimeTableEdgeFinding& operator=(const TimeTableEdgeFinding&) = delete;
 
+  std::string Name() const final { return "TimeTableEdgeFinding"; }
   bool Propagate() final;
 
   void RegisterWith(GenericLiteralWatcher* watcher);
@@ -81,6 +83,11 @@ class TimeTableEdgeFinding : public PropagatorInterface {
   // profile integral in a window efficiently during TimeTableEdgeFindingPass().
   void BuildTimeTable();
 
+  // Fills the window_* vectors with the tasks that can be the first task of a
+  // window in the quadratic loop of TimeTableEdgeFindingPass(), that is the
+  // present tasks with a free part, by decreasing start min.
+  void FillWindowTasks();
+
   // Performs a single pass of the Timetable Edge Finding filtering rule to
   // updates the start time of the tasks. This same function can be used to
   // update the end times by calling the SwitchToMirrorProblem method first.
@@ -115,6 +122,17 @@ class TimeTableEdgeFinding : public PropagatorInterface {
   std::vector<IntegerValue> mandatory_energy_before_start_min_;
   std::vector<IntegerValue> mandatory_energy_before_end_max_;
 
+  // The data used by the inner loop of TimeTableEdgeFindingPass() in structure
+  // of arrays form, see FillWindowTasks(). This loop is quadratic, so we filter
+  // the tasks once and then only read contiguous memory.
+  std::vector<int> window_tasks_;
+  std::vector<IntegerValue> window_start_mins_;
+  std::vector<IntegerValue> window_end_maxs_;
+  std::vector<IntegerValue> window_size_frees_;
+  std::vector<IntegerValue> window_energy_frees_;
+  std::vector<IntegerValue> window_demand_mins_;
+  std::vector<IntegerValue> window_mandatory_energies_;
+
   // List of task that should participate in the reason.
   std::vector<int> reason_tasks_fully_included_in_window_;
   std::vector<int> reason_tasks_partially_included_in_window_;
@@ -23,8 +23,12 @@
 #include "absl/log/check.h"
 #include "absl/strings/str_join.h"
 #include "absl/types/span.h"
+#include "benchmark/benchmark.h"
 #include "gtest/gtest.h"
 #include "ortools/base/logging.h"
+#include "ortools/base/path.h"
+#include "ortools/scheduling/rcpsp.pb.h"
+#include "ortools/scheduling/rcpsp_parser.h"
 #include "ortools/sat/all_different.h"
 #include "ortools/sat/cumulative.h"
 #include "ortools/sat/integer.h"
@@ -36,11 +40,20 @@
 #include "ortools/sat/sat_base.h"
 #include "ortools/sat/sat_solver.h"
 #include "ortools/sat/scheduling_helpers.h"
+#include "ortools/sat/timetable_edgefinding.h"
+
+#if !defined(ROOT_DIR)
+#define ROOT_DIR "_main"
+#endif
 
 namespace operations_research {
 namespace sat {
 namespace {
 
+using ::operations_research::scheduling::rcpsp::RcpspParser;
+using ::operations_research::scheduling::rcpsp::RcpspProblem;
+using ::operations_research::scheduling::rcpsp::Recipe;
+
 struct CumulativeTasks {
   int min_duration;
   int min_demand;
@@ -198,6 +211,38 @@ TEST(TimeTablingPropagation, PartialSumBug) {
                                          315));
 }
 
+// Checks that the same push is done again after a backtrack.
+TEST(TimeTablingPropagation, SamePushAfterBacktrack) {
+  Model model;
+  auto* integer_trail = model.GetOrCreate<IntegerTrail>();
+  auto* encoder = model.GetOrCreate<IntegerEncoder>();
+  auto* sat_solver = model.GetOrCreate<SatSolver>();
+  auto* repo = model.GetOrCreate<IntervalsRepository>();
+  const std::vector<IntervalVariable> intervals = {
+      model.Add(NewInterval(0, 10, 4)), model.Add(NewInterval(0, 10, 3))};
+  SchedulingConstraintHelper* helper = repo->GetOrCreateHelper(intervals);
+  const std::vector<AffineExpression> demands = {
+      AffineExpression(IntegerValue(1)), AffineExpression(IntegerValue(1))};
+  SchedulingDemandHelper* demands_helper =
+      model.TakeOwnership(new SchedulingDemandHelper(demands, helper, &model));
+  TimeTablingPerTask* timetabling = model.TakeOwnership(new TimeTablingPerTask(
+      AffineExpression(IntegerValue(1)), helper, demands_helper, &model));
+  timetabling->RegisterWith(model.GetOrCreate<GenericLiteralWatcher>());
+  ASSERT_TRUE(sat_solver->Propagate());
+
+  // Once the first task has the mandatory part [2, 4), the second task cannot
+  // start before 4.
+  const AffineExpression start = repo->Start(intervals[1]);
+  const Literal decision = encoder->GetOrCreateAssociatedLiteral(
+      repo->Start(intervals[0]).LowerOrEqual(2));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(sat_solver->EnqueueDecisionIfNotConflicting(decision));
+    EXPECT_EQ(integer_trail->LowerBound(start), 4);
+    sat_solver->Backtrack(0);
+    EXPECT_EQ(integer_trail->LowerBound(start), 0);
+  }
+}
+
 // TODO(user): build automatic FindAll tests for the cumulative constraint.
 // Test that we find all the solutions.
 TEST(TimeTablingSolve, FindAll) {
@@ -552,6 +597,90 @@ TEST(ReservoirTest, VariableLevelChange) {
   EXPECT_EQ(num_solutions_found, 1 << size);
 }
 
+// Loads the first recipe of each task of the given problem, with one cumulative
+// per renewable resource. The cumulatives are propagated by TimeTablingPerTask
+// and, if use_edge_finding is true, by TimeTableEdgeFinding. Returns the start
+// of the tasks.
+std::vector<AffineExpression> LoadRcpspCumulatives(const RcpspProblem& problem,
+                                                   bool use_edge_finding,
+                                                   Model* model) {
+  int64_t horizon = 0;
+  for (const auto& task : problem.tasks()) {
+    if (task.recipes_size() > 0) horizon += task.recipes(0).duration();
+  }
+
+  auto* repo = model->GetOrCreate<IntervalsRepository>();
+  auto* watcher = model->GetOrCreate<GenericLiteralWatcher>();
+  std::vector<AffineExpression> starts;
+  std::vector<std::vector<IntervalVariable>> intervals(
+      problem.resources_size());
+  std::vector<std::vector<AffineExpression>> demands(problem.resources_size());
+  for (const auto& task : problem.tasks()) {
+    if (task.recipes_size() == 0 || task.recipes(0).duration() == 0) continue;
+    const Recipe& recipe = task.recipes(0);
+    const IntervalVariable interval =
+        model->Add(NewInterval(0, horizon, recipe.duration()));
+    starts.push_back(repo->Start(interval));
+    for (int i = 0; i < recipe.resources_size(); ++i) {
+      if (recipe.demands(i) == 0) continue;
+      intervals[recipe.resources(i)].push_back(interval);
+      demands[recipe.resources(i)].push_back(
+          AffineExpression(IntegerValue(recipe.demands(i))));
+    }
+  }
+
+  for (int r = 0; r < problem.resources_size(); ++r) {
+    if (!problem.resources(r).renewable() || intervals[r].empty()) continue;
+    const AffineExpression capacity(
+        IntegerValue(problem.resources(r).max_capacity()));
+    SchedulingConstraintHelper* helper = repo->GetOrCreateHelper(intervals[r]);
+    SchedulingDemandHelper* demands_helper = model->TakeOwnership(
+        new SchedulingDemandHelper(demands[r], helper, model));
+    TimeTablingPerTask* timetabling = model->TakeOwnership(
+        new TimeTablingPerTask(capacity, helper, demands_helper, model));
+    timetabling->RegisterWith(watcher);
+    if (use_edge_finding) {
+      TimeTableEdgeFinding* edge_finding = model->TakeOwnership(
+          new TimeTableEdgeFinding(capacity, helper, demands_helper, model));
+      edge_finding->RegisterWith(watcher);
+    }
+  }
+  return starts;
+}
+
+// Measures the cumulative propagation along a dive that fixes the tasks one by
+// one at their earliest start, as a list scheduling heuristic would. The
+// propagators only see the tasks whose bounds changed at each decision.
+static void BM_RcpspCumulativePropagation(benchmark::State& state) {
+  RcpspParser parser;
+  CHECK(parser.ParseFile(file::JoinPathRespectAbsolute(
+      ::testing::SrcDir(),
+      ROOT_DIR "/ortools/scheduling/testdata/rg300_1.rcp")));
+  Model model;
+  const std::vector<AffineExpression> starts = LoadRcpspCumulatives(
+      parser.problem(), /*use_edge_finding=*/state.range(0), &model);
+  auto* integer_trail = model.GetOrCreate<IntegerTrail>();
+  auto* encoder = model.GetOrCreate<IntegerEncoder>();
+  auto* sat_solver = model.GetOrCreate<SatSolver>();
+  CHECK(sat_solver->Propagate());
+
+  int64_t num_decisions = 0;
+  for (auto _ : state) {
+    for (const AffineExpression start : starts) {
+      if (integer_trail->IsFixed(start)) continue;
+      const Literal decision = encoder->GetOrCreateAssociatedLiteral(
+          start.LowerOrEqual(integer_trail->LowerBound(start)));
+      if (!sat_solver->EnqueueDecisionIfNotConflicting(decision)) break;
+      ++num_decisions;
+    }
+    sat_solver->Backtrack(0);
+  }
+  state.counters["decisions"] =
+      benchmark::Counter(num_decisions, benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_RcpspCumulativePropagation)->Arg(0)->Arg(1);
+
 }  // namespace
 }  // namespace sat
 }  // namespace operations_research
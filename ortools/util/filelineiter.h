@@ -28,7 +28,9 @@
 #include <algorithm>
 #include <cstdint>
 #include <string>
+#include <vector>
 
+#include "absl/strings/string_view.h"
 #include "ortools/base/file.h"
 #include "ortools/base/logging.h"
 
@@ -173,4 +175,56 @@ class FileLines {
   const int options_;
 };
 
+// Reads the whole content of the given file in memory. Compressed files are
+// decompressed the same way as with FileLines. Returns false if the file cannot
+// be opened or read.
+//
+// This is meant for parsers that want to process the lines of a large file in
+// parallel with SplitIntoLineChunks().
+inline bool ReadFileContent(absl::string_view filename, std::string* content) {
+  content->clear();
+  File* file = nullptr;
+  if (!file::Open(filename, "r", &file, file::Defaults()).ok()) {
+    LOG(WARNING) << "Could not open: " << filename;
+    return false;
+  }
+  static constexpr int64_t kBufferSize = 1 << 20;
+  bool ok = true;
+  while (true) {
+    const int64_t old_size = content->size();
+    content->resize(old_size + kBufferSize);
+    const int64_t num_read = file->Read(&(*content)[old_size], kBufferSize);
+    if (num_read < 0) {
+      LOG(WARNING) << "Error while reading file.";
+      content->resize(old_size);
+      ok = false;
+      break;
+    }
+    content->resize(old_size + num_read);
+    if (num_read == 0) break;
+  }
+  file->Close(file::Defaults()).IgnoreError();
+  return ok;
+}
+
+// Splits the given text into at most num_chunks consecutive pieces of roughly
+// the same size. Each piece, except maybe the last one, ends with a '\n' so
+// that no line is split between two pieces.
+inline std::vector<absl::string_view> SplitIntoLineChunks(
+    absl::string_view text, int num_chunks) {
+  std::vector<absl::string_view> chunks;
+  const size_t target_size = text.size() / std::max(num_chunks, 1) + 1;
+  size_t start = 0;
+  while (start < text.size()) {
+    size_t end = std::min(text.size(), start + target_size);
+    if (end < text.size()) {
+      const size_t eol = text.find('\n', end - 1);
+      end = eol == absl::string_view::npos ? text.size() : eol + 1;
+    }
+    chunks.push_back(text.substr(start, end - start));
+    start = end;
+  }
+  return chunks;
+}
+
 #endif  // OR_TOOLS_UTIL_FILELINEITER_H_